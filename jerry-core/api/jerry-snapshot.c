@@ -35,10 +35,14 @@
  */
 static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
 snapshot_get_global_flags (bool has_regex, /**< regex literal is present */
-                           bool has_class) /**< class literal is present */
+                           bool has_class, /**< class literal is present */
+                           bool has_superinstructions, /**< compare and branch superinstruction is present */
+                           bool has_three_address_opcodes) /**< three-address binary opcode is present */
 {
   JERRY_UNUSED (has_regex);
   JERRY_UNUSED (has_class);
+  JERRY_UNUSED (has_superinstructions);
+  JERRY_UNUSED (has_three_address_opcodes);
 
   uint32_t flags = 0;
 
@@ -48,6 +52,12 @@ snapshot_get_global_flags (bool has_regex, /**< regex literal is present */
 #if ENABLED (JERRY_ES2015)
   flags |= (has_class ? JERRY_SNAPSHOT_HAS_CLASS_LITERAL : 0);
 #endif /* ENABLED (JERRY_ES2015) */
+#if ENABLED (JERRY_VM_SUPERINSTRUCTIONS)
+  flags |= (has_superinstructions ? JERRY_SNAPSHOT_HAS_SUPERINSTRUCTIONS : 0);
+#endif /* ENABLED (JERRY_VM_SUPERINSTRUCTIONS) */
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+  flags |= (has_three_address_opcodes ? JERRY_SNAPSHOT_HAS_THREE_ADDRESS_OPCODES : 0);
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
 
   return flags;
 } /* snapshot_get_global_flags */
@@ -66,8 +76,14 @@ snapshot_check_global_flags (uint32_t global_flags) /**< global flags */
 #if ENABLED (JERRY_ES2015)
   global_flags &= (uint32_t) ~JERRY_SNAPSHOT_HAS_CLASS_LITERAL;
 #endif /* ENABLED (JERRY_ES2015) */
-
-  return global_flags == snapshot_get_global_flags (false, false);
+#if ENABLED (JERRY_VM_SUPERINSTRUCTIONS)
+  global_flags &= (uint32_t) ~JERRY_SNAPSHOT_HAS_SUPERINSTRUCTIONS;
+#endif /* ENABLED (JERRY_VM_SUPERINSTRUCTIONS) */
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+  global_flags &= (uint32_t) ~JERRY_SNAPSHOT_HAS_THREE_ADDRESS_OPCODES;
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+
+  return global_flags == snapshot_get_global_flags (false, false, false, false);
 } /* snapshot_check_global_flags */
 
 #endif /* ENABLED (JERRY_SNAPSHOT_SAVE) || ENABLED (JERRY_SNAPSHOT_EXEC) */
@@ -758,6 +774,13 @@ jerry_generate_snapshot_with_args (const jerry_char_t *resource_name_p, /**< scr
   globals.regex_found = false;
   globals.class_found = false;
 
+#if ENABLED (JERRY_VM_SUPERINSTRUCTIONS)
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_HAS_SUPERINSTRUCTIONS;
+#endif /* ENABLED (JERRY_VM_SUPERINSTRUCTIONS) */
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_HAS_THREE_ADDRESS_OPCODES;
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+
   parse_status = parser_parse_script (args_p,
                                       args_size,
                                       source_p,
@@ -790,7 +813,21 @@ jerry_generate_snapshot_with_args (const jerry_char_t *resource_name_p, /**< scr
   jerry_snapshot_header_t header;
   header.magic = JERRY_SNAPSHOT_MAGIC;
   header.version = JERRY_SNAPSHOT_VERSION;
-  header.global_flags = snapshot_get_global_flags (globals.regex_found, globals.class_found);
+#if ENABLED (JERRY_VM_SUPERINSTRUCTIONS)
+  bool superinstructions_found = (JERRY_CONTEXT (status_flags) & ECMA_STATUS_HAS_SUPERINSTRUCTIONS) != 0;
+#else /* !ENABLED (JERRY_VM_SUPERINSTRUCTIONS) */
+  bool superinstructions_found = false;
+#endif /* ENABLED (JERRY_VM_SUPERINSTRUCTIONS) */
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+  bool three_address_opcodes_found = (JERRY_CONTEXT (status_flags) & ECMA_STATUS_HAS_THREE_ADDRESS_OPCODES) != 0;
+#else /* !ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+  bool three_address_opcodes_found = false;
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+
+  header.global_flags = snapshot_get_global_flags (globals.regex_found,
+                                                   globals.class_found,
+                                                   superinstructions_found,
+                                                   three_address_opcodes_found);
   header.lit_table_offset = (uint32_t) globals.snapshot_buffer_write_offset;
   header.number_of_funcs = 1;
   header.func_offsets[0] = aligned_header_size;
@@ -95,6 +95,16 @@ JERRY_STATIC_ASSERT ((int) ECMA_PROMISE_IS_PENDING == (int) JERRY_PROMISE_STATE_
                      promise_internal_state_matches_external);
 #endif /* ENABLED (JERRY_ES2015_BUILTIN_PROMISE) */
 
+JERRY_STATIC_ASSERT (JERRY_GC_PAUSE_HISTOGRAM_SIZE == JMEM_GC_PAUSE_HISTOGRAM_SIZE,
+                     gc_pause_histogram_size_must_be_equal_to_jmem_gc_pause_histogram_size);
+
+JERRY_STATIC_ASSERT (sizeof (jerry_heap_stats_t) == 8 * sizeof (size_t),
+                     jerry_heap_stats_t_must_keep_its_size_for_binary_compatibility);
+
+JERRY_STATIC_ASSERT (JERRY_GC_TELEMETRY_SIZE_CLASS_COUNT == JMEM_TELEMETRY_SIZE_CLASS_COUNT
+                     && JMEM_ALIGNMENT == 8,
+                     gc_telemetry_size_classes_must_be_equal_to_jmem_telemetry_size_classes);
+
 /**
  * Offset between internal and external arithmetic operator types
  */
@@ -360,12 +370,76 @@ jerry_gc (jerry_gc_mode_t mode) /**< operational mode */
   {
     /* Call GC directly, because 'ecma_free_unused_memory' might decide it's not yet worth it. */
     ecma_gc_run ();
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+    ecma_gc_finish_lazy_sweep ();
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
     return;
   }
 
+#if ENABLED (JERRY_GC_COMPACTION)
+  /* Heap blocks can only be moved when the engine holds no direct pointers to them. */
+  if (JERRY_CONTEXT (vm_top_context_p) == NULL)
+  {
+    JERRY_CONTEXT (status_flags) |= ECMA_STATUS_GC_COMPACT;
+  }
+#endif /* ENABLED (JERRY_GC_COMPACTION) */
+
   ecma_free_unused_memory (JMEM_PRESSURE_HIGH);
+
+#if ENABLED (JERRY_GC_COMPACTION)
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_GC_COMPACT;
+#endif /* ENABLED (JERRY_GC_COMPACTION) */
 } /* jerry_gc */
 
+/**
+ * Perform an incremental step of garbage collection within the given time budget.
+ *
+ * Note:
+ *      if incremental garbage collection is disabled, a full collection is performed
+ *
+ * @return true - if the current collection cycle is not finished yet
+ *         false - otherwise
+ */
+bool
+jerry_gc_step (uint32_t budget_us) /**< time budget in microseconds */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_GC_INCREMENTAL)
+  return ecma_gc_step (budget_us);
+#else /* !ENABLED (JERRY_GC_INCREMENTAL) */
+  JERRY_UNUSED (budget_us);
+
+  ecma_gc_run ();
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+  ecma_gc_finish_lazy_sweep ();
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
+  return false;
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+} /* jerry_gc_step */
+
+/**
+ * Free the unreachable objects left over by the last garbage collection within the given time budget.
+ *
+ * Note:
+ *      the objects are only left over when lazy sweeping is enabled
+ *
+ * @return true - if there are unreachable objects which are not freed yet
+ *         false - otherwise
+ */
+bool
+jerry_gc_sweep_step (uint32_t budget_us) /**< time budget in microseconds */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+  return ecma_gc_sweep_step (budget_us);
+#else /* !ENABLED (JERRY_GC_LAZY_SWEEP) */
+  JERRY_UNUSED (budget_us);
+  return false;
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
+} /* jerry_gc_sweep_step */
+
 /**
  * Get heap memory stats.
  *
@@ -387,10 +461,13 @@ jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p) /**< [out] heap memory
 
   *out_stats_p = (jerry_heap_stats_t)
   {
-    .version = 1,
+    .version = 2,
     .size = jmem_heap_stats.size,
     .allocated_bytes = jmem_heap_stats.allocated_bytes,
-    .peak_allocated_bytes = jmem_heap_stats.peak_allocated_bytes
+    .peak_allocated_bytes = jmem_heap_stats.peak_allocated_bytes,
+    .free_region_bytes = jmem_heap_stats.free_region_bytes,
+    .largest_free_region = jmem_heap_stats.largest_free_region,
+    .size_class_bytes = jmem_heap_stats.size_class_bytes
   };
 
   return true;
@@ -400,6 +477,85 @@ jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p) /**< [out] heap memory
 #endif /* ENABLED (JERRY_MEM_STATS) */
 } /* jerry_get_memory_stats */
 
+/**
+ * Get the garbage collector and allocator telemetry of the current context.
+ *
+ * Note:
+ *      the counters are maintained in every build, unlike the heap memory stats
+ *
+ * @return true - if the telemetry is written into the out parameter
+ *         false - if the out parameter is NULL
+ */
+bool
+jerry_get_gc_telemetry (jerry_gc_telemetry_t *out_telemetry_p) /**< [out] telemetry counters */
+{
+  jerry_assert_api_available ();
+
+  if (out_telemetry_p == NULL)
+  {
+    return false;
+  }
+
+  const jmem_telemetry_t *telemetry_p = &JERRY_CONTEXT (jmem_telemetry);
+
+  *out_telemetry_p = (jerry_gc_telemetry_t)
+  {
+    .version = 1,
+    .gc_count = telemetry_p->gc_count,
+    .gc_pause_count = telemetry_p->gc_pause_count,
+    .gc_pause_total_us = telemetry_p->gc_pause_total_us,
+    .gc_pause_max_us = telemetry_p->gc_pause_max_us,
+    .gc_marked_objects = telemetry_p->gc_marked_objects,
+    .gc_swept_objects = telemetry_p->gc_swept_objects,
+    .gc_marked_objects_total = telemetry_p->gc_marked_objects_total,
+    .gc_swept_objects_total = telemetry_p->gc_swept_objects_total,
+    .first_fit_count = telemetry_p->first_fit_count,
+    .first_fit_steps = telemetry_p->first_fit_steps,
+    .first_fit_max_steps = telemetry_p->first_fit_max_steps
+  };
+
+  memcpy (out_telemetry_p->gc_pause_histogram,
+          telemetry_p->gc_pause_histogram,
+          sizeof (out_telemetry_p->gc_pause_histogram));
+  memcpy (out_telemetry_p->alloc_count, telemetry_p->alloc_count, sizeof (out_telemetry_p->alloc_count));
+
+  return true;
+} /* jerry_get_gc_telemetry */
+
+/**
+ * Get the inline cache counters of the current context.
+ *
+ * Note:
+ *      the counters are only maintained if the inline caches are enabled (JERRY_INLINE_CACHE)
+ *
+ * @return true - if the counters are written into the out parameter
+ *         false - if the out parameter is NULL or the inline caches are disabled
+ */
+bool
+jerry_get_inline_cache_stats (jerry_inline_cache_stats_t *out_stats_p) /**< [out] inline cache counters */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_INLINE_CACHE)
+  if (out_stats_p == NULL)
+  {
+    return false;
+  }
+
+  *out_stats_p = (jerry_inline_cache_stats_t)
+  {
+    .version = 1,
+    .hits = JERRY_CONTEXT (ecma_icache_hits),
+    .misses = JERRY_CONTEXT (ecma_icache_misses)
+  };
+
+  return true;
+#else /* !ENABLED (JERRY_INLINE_CACHE) */
+  JERRY_UNUSED (out_stats_p);
+  return false;
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+} /* jerry_get_inline_cache_stats */
+
 /**
  * Simple Jerry runner
  *
@@ -1051,6 +1207,18 @@ jerry_is_feature_enabled (const jerry_feature_t feature) /**< feature to check *
 #if ENABLED (JERRY_ES2015_BUILTIN_WEAKSET)
           || feature == JERRY_FEATURE_WEAKSET
 #endif /* ENABLED (JERRY_ES2015_BUILTIN_WEAKSET) */
+#if ENABLED (JERRY_GC_INCREMENTAL)
+          || feature == JERRY_FEATURE_GC_INCREMENTAL
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+#if ENABLED (JERRY_GC_GENERATIONAL)
+          || feature == JERRY_FEATURE_GC_GENERATIONAL
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+          || feature == JERRY_FEATURE_GC_LAZY_SWEEP
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
+#if ENABLED (JERRY_VM_PROFILER)
+          || feature == JERRY_FEATURE_VM_PROFILER
+#endif /* ENABLED (JERRY_VM_PROFILER) */
           );
 } /* jerry_is_feature_enabled */
 
@@ -2549,6 +2717,7 @@ jerry_set_internal_property (const jerry_value_t obj_val, /**< object value */
                                                                       ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
                                                                       NULL);
 
+    ECMA_GC_WRITE_BARRIER (internal_object_p, value_to_set);
     value_p->value = ecma_copy_value_if_not_object (value_to_set);
   }
   else
@@ -3074,6 +3243,10 @@ jerry_objects_foreach (jerry_objects_foreach_t foreach_p, /**< function pointer
 
   JERRY_ASSERT (foreach_p != NULL);
 
+#if ENABLED (JERRY_GC_INCREMENTAL)
+  ecma_gc_finish_incremental_sweep ();
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
   jmem_cpointer_t iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
   while (iter_cp != JMEM_CP_NULL)
@@ -3112,6 +3285,10 @@ jerry_objects_foreach_by_native_info (const jerry_object_native_info_t *native_i
 
   ecma_native_pointer_t *native_pointer_p;
 
+#if ENABLED (JERRY_GC_INCREMENTAL)
+  ecma_gc_finish_incremental_sweep ();
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
   jmem_cpointer_t iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
   while (iter_cp != JMEM_CP_NULL)
@@ -3573,6 +3750,33 @@ jerry_set_vm_exec_stop_callback (jerry_vm_exec_stop_callback_t stop_cb, /**< per
 #endif /* ENABLED (JERRY_VM_EXEC_STOP) */
 } /* jerry_set_vm_exec_stop_callback */
 
+/**
+ * If JERRY_VM_PROFILER is enabled the callback passed to this function receives
+ * the call stack of the running script at every frequency backward branches or
+ * function calls.
+ */
+void
+jerry_set_vm_profile_callback (jerry_vm_profile_callback_t profile_cb, /**< periodically called user function */
+                               void *user_p, /**< pointer passed to the function */
+                               uint32_t frequency) /**< number of events between two samples */
+{
+#if ENABLED (JERRY_VM_PROFILER)
+  if (frequency == 0)
+  {
+    frequency = 1;
+  }
+
+  JERRY_CONTEXT (vm_profile_frequency) = frequency;
+  JERRY_CONTEXT (vm_profile_counter) = frequency;
+  JERRY_CONTEXT (vm_profile_user_p) = user_p;
+  JERRY_CONTEXT (vm_profile_cb) = profile_cb;
+#else /* !ENABLED (JERRY_VM_PROFILER) */
+  JERRY_UNUSED (profile_cb);
+  JERRY_UNUSED (user_p);
+  JERRY_UNUSED (frequency);
+#endif /* ENABLED (JERRY_VM_PROFILER) */
+} /* jerry_set_vm_profile_callback */
+
 /**
  * Get backtrace. The backtrace is an array of strings where
  * each string contains the position of the corresponding frame.
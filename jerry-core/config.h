@@ -333,14 +333,54 @@
 #endif /* !defined (JERRY_STACK_LIMIT) */
 
 /**
- * Maximum depth of recursion during GC mark phase
+ * Size of the VM stack in kilobytes
  *
- * Default value: 8
+ * The frames of the running functions are allocated from this stack, which is
+ * part of the engine context. A RangeError is thrown when it is full.
+ *
+ * Default value: 0, the frames are allocated on the C stack
+ */
+#ifndef JERRY_VM_STACK_SIZE
+# define JERRY_VM_STACK_SIZE (0)
+#endif /* !defined (JERRY_VM_STACK_SIZE) */
+
+/**
+ * Maximum number of gray objects stored on the worklist of the GC mark phase
+ *
+ * Default value: 32
  */
 #ifndef JERRY_GC_MARK_LIMIT
-# define JERRY_GC_MARK_LIMIT (8)
+# define JERRY_GC_MARK_LIMIT (32)
 #endif /* !defined (JERRY_GC_MARK_LIMIT) */
 
+/**
+ * Target pause of the garbage collections in microseconds, used by the adaptive garbage collection trigger
+ *
+ * Default value: 1000
+ */
+#ifndef JERRY_GC_TARGET_PAUSE
+# define JERRY_GC_TARGET_PAUSE (1000)
+#endif /* !defined (JERRY_GC_TARGET_PAUSE) */
+
+/**
+ * Heap usage increase allowed until the next garbage collection, as the percentage of the live heap size,
+ * used by the adaptive garbage collection trigger
+ *
+ * Default value: 100
+ */
+#ifndef JERRY_GC_HEAP_GROWTH
+# define JERRY_GC_HEAP_GROWTH (100)
+#endif /* !defined (JERRY_GC_HEAP_GROWTH) */
+
+/**
+ * Number of workers of the parallel garbage collector marking
+ *
+ * Default value: 4
+ */
+#ifndef JERRY_GC_MARK_THREADS
+# define JERRY_GC_MARK_THREADS (4)
+#endif /* !defined (JERRY_GC_MARK_THREADS) */
+
 /**
  * Enable/Disable property lookup cache.
  *
@@ -555,6 +595,258 @@
 # define JERRY_VM_EXEC_STOP 0
 #endif /* !defined (JERRY_VM_EXEC_STOP) */
 
+/**
+ * Enable/Disable the incremental garbage collector.
+ *
+ * Allowed values:
+ *  0: Disable incremental garbage collection.
+ *  1: Enable the time-sliced jerry_gc_step API and the write barrier it depends on.
+ */
+#ifndef JERRY_GC_INCREMENTAL
+# define JERRY_GC_INCREMENTAL 0
+#endif /* !defined (JERRY_GC_INCREMENTAL) */
+
+/**
+ * Enable/Disable the generational garbage collector.
+ *
+ * Allowed values:
+ *  0: Disable generational garbage collection.
+ *  1: Collect the recently allocated objects separately, using a remembered set for old-to-young references.
+ */
+#ifndef JERRY_GC_GENERATIONAL
+# define JERRY_GC_GENERATIONAL 0
+#endif /* !defined (JERRY_GC_GENERATIONAL) */
+
+/**
+ * Enable/Disable the size class free lists of the heap allocator.
+ *
+ * Allowed values:
+ *  0: Every heap block is returned to the address ordered free region list.
+ *  1: Freed blocks of 16 - 128 bytes are kept on a separate free list for each size,
+ *     so allocating and freeing them takes constant time.
+ */
+#ifndef JERRY_MEM_SIZE_CLASSES
+# define JERRY_MEM_SIZE_CLASSES 0
+#endif /* !defined (JERRY_MEM_SIZE_CLASSES) */
+
+/**
+ * Enable/Disable the slab allocator behind the JerryHeapMalloc / JerryHeapFree hooks.
+ *
+ * Allowed values:
+ *  0: The hooks do not allocate anything, every block is allocated by the heap allocator.
+ *  1: Blocks of 9 - 24 bytes are allocated from slabs carved from the heap, each slab
+ *     serving a single block size and tracking its free slots in a bitmap.
+ */
+#ifndef JERRY_MEM_SLAB_ALLOCATOR
+# define JERRY_MEM_SLAB_ALLOCATOR 0
+#endif /* !defined (JERRY_MEM_SLAB_ALLOCATOR) */
+
+/**
+ * Enable/Disable compaction of the property and array storage.
+ *
+ * Allowed values:
+ *  0: Heap blocks are never moved.
+ *  1: A high pressure garbage collection requested by jerry_gc while no JavaScript
+ *     code is running moves the property pairs and fast array buffers towards
+ *     the beginning of the heap, so the free regions are merged.
+ *
+ * Note:
+ *     objects and strings are never moved, and a failing allocation does not compact
+ *     the heap, so fragmentation can still cause an out-of-memory error during execution
+ */
+#ifndef JERRY_GC_COMPACTION
+# define JERRY_GC_COMPACTION 0
+#endif /* !defined (JERRY_GC_COMPACTION) */
+
+/**
+ * Enable/Disable lazy sweeping.
+ *
+ * Allowed values:
+ *  0: The unreachable objects are freed by the garbage collection which found them.
+ *  1: The unreachable objects are kept on a list and freed in small batches by the
+ *     following allocations or by jerry_gc_sweep_step, which shortens the pause
+ *     of the garbage collections triggered by the allocator.
+ */
+#ifndef JERRY_GC_LAZY_SWEEP
+# define JERRY_GC_LAZY_SWEEP 0
+#endif /* !defined (JERRY_GC_LAZY_SWEEP) */
+
+/**
+ * Enable/Disable the adaptive garbage collection trigger.
+ *
+ * Allowed values:
+ *  0: The heap usage limit which triggers the next garbage collection is moved
+ *     in fixed JERRY_GC_LIMIT steps.
+ *  1: The heap usage increase allowed until the next garbage collection is computed
+ *     after each collection from the live heap size, the survival ratio, the allocation
+ *     rate and the pause time (see JERRY_GC_TARGET_PAUSE and JERRY_GC_HEAP_GROWTH).
+ */
+#ifndef JERRY_GC_ADAPTIVE_LIMIT
+# define JERRY_GC_ADAPTIVE_LIMIT 0
+#endif /* !defined (JERRY_GC_ADAPTIVE_LIMIT) */
+
+/**
+ * Enable/Disable parallel marking of the garbage collector.
+ *
+ * Allowed values:
+ *  0: The mark phase runs on the calling thread.
+ *  1: The mark phase of the full garbage collections of large heaps is run by
+ *     JERRY_GC_MARK_THREADS workers, which are started by the jerry_port_run_parallel
+ *     port function. Requires a compiler which supports the GCC atomic builtins
+ *     and thread local storage.
+ */
+#ifndef JERRY_GC_PARALLEL_MARK
+# define JERRY_GC_PARALLEL_MARK 0
+#endif /* !defined (JERRY_GC_PARALLEL_MARK) */
+
+/**
+ * Enable/Disable direct threaded dispatch of the byte code interpreter.
+ *
+ * Allowed values:
+ *  0: The opcode handlers are selected by a switch statement.
+ *  1: The opcode handlers are selected by an indirect jump through a table of
+ *     label addresses. Requires a compiler which supports the GCC labels as values
+ *     extension.
+ */
+#ifndef JERRY_VM_COMPUTED_GOTO
+# define JERRY_VM_COMPUTED_GOTO 0
+#endif /* !defined (JERRY_VM_COMPUTED_GOTO) */
+
+/**
+ * Enable/Disable shared shapes (hidden classes) for ordinary objects.
+ *
+ * Allowed values:
+ *  0: Each object stores the names of its properties in its own property pairs.
+ *  1: The property names of ordinary objects are stored in shapes shared by all
+ *     objects which created the same properties in the same order, and the
+ *     objects only store the property values.
+ */
+#ifndef JERRY_OBJECT_SHAPES
+# define JERRY_OBJECT_SHAPES 0
+#endif /* !defined (JERRY_OBJECT_SHAPES) */
+
+/**
+ * Enable/Disable the inline caches of the property access byte codes.
+ *
+ * Allowed values:
+ *  0: Property accesses only use the property lookup cache.
+ *  1: Each property get and set instruction remembers the shapes of the objects
+ *     it accessed and the slot of the property, so objects of the same shape
+ *     hit the cache without searching their properties.
+ *
+ * Note:
+ *  requires JERRY_OBJECT_SHAPES.
+ */
+#ifndef JERRY_INLINE_CACHE
+# define JERRY_INLINE_CACHE 0
+#endif /* !defined (JERRY_INLINE_CACHE) */
+
+/**
+ * Enable/Disable the fused compare and branch byte codes.
+ *
+ * Allowed values:
+ *  0: Comparisons push their result onto the stack and the next conditional
+ *     branch pops it.
+ *  1: The parser replaces the comparisons which are followed by a conditional
+ *     branch with superinstructions, which evaluate the comparison and execute
+ *     the branch in a single dispatch.
+ */
+#ifndef JERRY_VM_SUPERINSTRUCTIONS
+# define JERRY_VM_SUPERINSTRUCTIONS 0
+#endif /* !defined (JERRY_VM_SUPERINSTRUCTIONS) */
+
+/**
+ * Enable/Disable the three-address forms of the binary byte codes.
+ *
+ * Allowed values:
+ *  0: Binary operations push their result onto the stack and the assignment
+ *     which follows them pops it.
+ *  1: The parser merges the binary operations with the identifier assignment
+ *     which follows them, and the result is stored directly into the register
+ *     or variable.
+ */
+#ifndef JERRY_VM_THREE_ADDRESS_OPCODES
+# define JERRY_VM_THREE_ADDRESS_OPCODES 0
+#endif /* !defined (JERRY_VM_THREE_ADDRESS_OPCODES) */
+
+/**
+ * Enable/Disable calls between byte code functions without recursion.
+ *
+ * Allowed values:
+ *  0: Every function call re-enters the virtual machine recursively.
+ *  1: Calls of simple byte code functions push a new frame onto the VM stack
+ *     and the caller continues when the frame returns. Requires a non-zero
+ *     JERRY_VM_STACK_SIZE.
+ */
+#ifndef JERRY_VM_DIRECT_CALLS
+# define JERRY_VM_DIRECT_CALLS 0
+#endif /* !defined (JERRY_VM_DIRECT_CALLS) */
+
+/**
+ * Enable/Disable the sampling profiler of the virtual machine.
+ *
+ * Allowed values:
+ *  0: Disable the profiler.
+ *  1: Backward branches and function calls are counted, and the call stack
+ *     is passed to the callback set by jerry_set_vm_profile_callback
+ *     when the sampling interval elapses.
+ */
+#ifndef JERRY_VM_PROFILER
+# define JERRY_VM_PROFILER 0
+#endif /* !defined (JERRY_VM_PROFILER) */
+
+/**
+ * Enable/Disable rope strings.
+ *
+ * Allowed values:
+ *  0: Concatenation always copies both strings into a new string.
+ *  1: Concatenation of long strings creates a rope node which references
+ *     both parts, and the characters are copied only when they are needed.
+ */
+#ifndef JERRY_ROPE_STRINGS
+# define JERRY_ROPE_STRINGS 0
+#endif /* !defined (JERRY_ROPE_STRINGS) */
+
+/**
+ * Enable/Disable index tables of non-ASCII strings.
+ *
+ * Allowed values:
+ *  0: Accessing a character of a non-ASCII string by its index scans the
+ *     string from the beginning.
+ *  1: A table which maps every 32nd code unit to its byte offset is built for
+ *     long non-ASCII strings when a character is first accessed by its index.
+ */
+#ifndef JERRY_STRING_INDEX
+# define JERRY_STRING_INDEX 0
+#endif /* !defined (JERRY_STRING_INDEX) */
+
+/**
+ * Enable/Disable the hash tables of the literal strings and numbers.
+ *
+ * Allowed values:
+ *  0: The literal cache hooks are empty, and a literal string or number is
+ *     searched by scanning the whole literal storage.
+ *  1: The literal cache hooks maintain an open addressing hash table of the
+ *     literal strings in the heap, and a similar table indexes the literal
+ *     numbers.
+ */
+#ifndef JERRY_LIT_HASH_TABLE
+# define JERRY_LIT_HASH_TABLE 0
+#endif /* !defined (JERRY_LIT_HASH_TABLE) */
+
+/**
+ * Enable/Disable the directly encoded floating point numbers.
+ *
+ * Allowed values:
+ *  0: Every number which is not a small integer is allocated on the heap.
+ *  1: Numbers which are exactly representable as a single precision float
+ *     with three zero low mantissa bits are encoded into the ecma value,
+ *     the other numbers are still allocated on the heap.
+ */
+#ifndef JERRY_DIRECT_FLOAT
+# define JERRY_DIRECT_FLOAT 0
+#endif /* !defined (JERRY_DIRECT_FLOAT) */
+
 /**
  * Advanced section configurations.
  */
@@ -715,9 +1007,21 @@
 #if !defined (JERRY_STACK_LIMIT) || (JERRY_STACK_LIMIT < 0)
 # error "Invalid value for 'JERRY_STACK_LIMIT' macro."
 #endif
+#if !defined (JERRY_VM_STACK_SIZE) || (JERRY_VM_STACK_SIZE < 0)
+# error "Invalid value for 'JERRY_VM_STACK_SIZE' macro."
+#endif
 #if !defined (JERRY_GC_MARK_LIMIT) || (JERRY_GC_MARK_LIMIT < 0)
 # error "Invalid value for 'JERRY_GC_MARK_LIMIT' macro."
 #endif
+#if !defined (JERRY_GC_TARGET_PAUSE) || (JERRY_GC_TARGET_PAUSE <= 0)
+# error "Invalid value for 'JERRY_GC_TARGET_PAUSE' macro."
+#endif
+#if !defined (JERRY_GC_HEAP_GROWTH) || (JERRY_GC_HEAP_GROWTH <= 0)
+# error "Invalid value for 'JERRY_GC_HEAP_GROWTH' macro."
+#endif
+#if !defined (JERRY_GC_MARK_THREADS) || (JERRY_GC_MARK_THREADS <= 0) || (JERRY_GC_MARK_THREADS > 64)
+# error "Invalid value for 'JERRY_GC_MARK_THREADS' macro."
+#endif
 #if !defined (JERRY_LCACHE) \
 || ((JERRY_LCACHE != 0) && (JERRY_LCACHE != 1))
 # error "Invalid value for 'JERRY_LCACHE' macro."
@@ -786,6 +1090,88 @@
 || ((JERRY_VM_EXEC_STOP != 0) && (JERRY_VM_EXEC_STOP != 1))
 # error "Invalid value for 'JERRY_VM_EXEC_STOP' macro."
 #endif
+#if !defined (JERRY_GC_INCREMENTAL) \
+|| ((JERRY_GC_INCREMENTAL != 0) && (JERRY_GC_INCREMENTAL != 1))
+# error "Invalid value for 'JERRY_GC_INCREMENTAL' macro."
+#endif
+#if !defined (JERRY_GC_GENERATIONAL) \
+|| ((JERRY_GC_GENERATIONAL != 0) && (JERRY_GC_GENERATIONAL != 1))
+# error "Invalid value for 'JERRY_GC_GENERATIONAL' macro."
+#endif
+#if !defined (JERRY_MEM_SIZE_CLASSES) \
+|| ((JERRY_MEM_SIZE_CLASSES != 0) && (JERRY_MEM_SIZE_CLASSES != 1))
+# error "Invalid value for 'JERRY_MEM_SIZE_CLASSES' macro."
+#endif
+#if !defined (JERRY_MEM_SLAB_ALLOCATOR) \
+|| ((JERRY_MEM_SLAB_ALLOCATOR != 0) && (JERRY_MEM_SLAB_ALLOCATOR != 1))
+# error "Invalid value for 'JERRY_MEM_SLAB_ALLOCATOR' macro."
+#endif
+#if !defined (JERRY_GC_COMPACTION) \
+|| ((JERRY_GC_COMPACTION != 0) && (JERRY_GC_COMPACTION != 1))
+# error "Invalid value for 'JERRY_GC_COMPACTION' macro."
+#endif
+#if !defined (JERRY_GC_LAZY_SWEEP) \
+|| ((JERRY_GC_LAZY_SWEEP != 0) && (JERRY_GC_LAZY_SWEEP != 1))
+# error "Invalid value for 'JERRY_GC_LAZY_SWEEP' macro."
+#endif
+#if !defined (JERRY_GC_ADAPTIVE_LIMIT) \
+|| ((JERRY_GC_ADAPTIVE_LIMIT != 0) && (JERRY_GC_ADAPTIVE_LIMIT != 1))
+# error "Invalid value for 'JERRY_GC_ADAPTIVE_LIMIT' macro."
+#endif
+#if !defined (JERRY_GC_PARALLEL_MARK) \
+|| ((JERRY_GC_PARALLEL_MARK != 0) && (JERRY_GC_PARALLEL_MARK != 1))
+# error "Invalid value for 'JERRY_GC_PARALLEL_MARK' macro."
+#endif
+#if (JERRY_GC_PARALLEL_MARK == 1) && !defined (__GNUC__)
+# error "Parallel marking of the garbage collector requires the GCC atomic builtins."
+#endif
+#if !defined (JERRY_VM_COMPUTED_GOTO) \
+|| ((JERRY_VM_COMPUTED_GOTO != 0) && (JERRY_VM_COMPUTED_GOTO != 1))
+# error "Invalid value for 'JERRY_VM_COMPUTED_GOTO' macro."
+#endif
+#if (JERRY_VM_COMPUTED_GOTO == 1) && !defined (__GNUC__)
+# error "Direct threaded dispatch requires the GCC labels as values extension."
+#endif
+#if !defined (JERRY_OBJECT_SHAPES) \
+|| ((JERRY_OBJECT_SHAPES != 0) && (JERRY_OBJECT_SHAPES != 1))
+# error "Invalid value for 'JERRY_OBJECT_SHAPES' macro."
+#endif
+#if !defined (JERRY_INLINE_CACHE) \
+|| ((JERRY_INLINE_CACHE != 0) && (JERRY_INLINE_CACHE != 1))
+# error "Invalid value for 'JERRY_INLINE_CACHE' macro."
+#endif
+#if !defined (JERRY_VM_SUPERINSTRUCTIONS) \
+|| ((JERRY_VM_SUPERINSTRUCTIONS != 0) && (JERRY_VM_SUPERINSTRUCTIONS != 1))
+# error "Invalid value for 'JERRY_VM_SUPERINSTRUCTIONS' macro."
+#endif
+#if !defined (JERRY_VM_THREE_ADDRESS_OPCODES) \
+|| ((JERRY_VM_THREE_ADDRESS_OPCODES != 0) && (JERRY_VM_THREE_ADDRESS_OPCODES != 1))
+# error "Invalid value for 'JERRY_VM_THREE_ADDRESS_OPCODES' macro."
+#endif
+#if !defined (JERRY_VM_DIRECT_CALLS) \
+|| ((JERRY_VM_DIRECT_CALLS != 0) && (JERRY_VM_DIRECT_CALLS != 1))
+# error "Invalid value for 'JERRY_VM_DIRECT_CALLS' macro."
+#endif
+#if !defined (JERRY_VM_PROFILER) \
+|| ((JERRY_VM_PROFILER != 0) && (JERRY_VM_PROFILER != 1))
+# error "Invalid value for 'JERRY_VM_PROFILER' macro."
+#endif
+#if !defined (JERRY_ROPE_STRINGS) \
+|| ((JERRY_ROPE_STRINGS != 0) && (JERRY_ROPE_STRINGS != 1))
+# error "Invalid value for 'JERRY_ROPE_STRINGS' macro."
+#endif
+#if !defined (JERRY_STRING_INDEX) \
+|| ((JERRY_STRING_INDEX != 0) && (JERRY_STRING_INDEX != 1))
+# error "Invalid value for 'JERRY_STRING_INDEX' macro."
+#endif
+#if !defined (JERRY_LIT_HASH_TABLE) \
+|| ((JERRY_LIT_HASH_TABLE != 0) && (JERRY_LIT_HASH_TABLE != 1))
+# error "Invalid value for 'JERRY_LIT_HASH_TABLE' macro."
+#endif
+#if !defined (JERRY_DIRECT_FLOAT) \
+|| ((JERRY_DIRECT_FLOAT != 0) && (JERRY_DIRECT_FLOAT != 1))
+# error "Invalid value for 'JERRY_DIRECT_FLOAT' macro."
+#endif
 
 #define ENABLED(FEATURE) ((FEATURE) == 1)
 #define DISABLED(FEATURE) ((FEATURE) != 1)
@@ -801,6 +1187,27 @@
 #  error "Date does not support float32"
 #endif
 
+/**
+ * The generational garbage collector indexes its side tables by the offset of objects in the jerry heap.
+ */
+#if ENABLED (JERRY_GC_GENERATIONAL) && ENABLED (JERRY_SYSTEM_ALLOCATOR)
+#  error "Generational garbage collection cannot be used with the system allocator"
+#endif
+
+/**
+ * The inline caches are keyed by the shapes of the objects.
+ */
+#if ENABLED (JERRY_INLINE_CACHE) && !ENABLED (JERRY_OBJECT_SHAPES)
+#  error "Inline caches require object shapes"
+#endif
+
+/**
+ * The frames of the direct calls are allocated on the VM stack.
+ */
+#if ENABLED (JERRY_VM_DIRECT_CALLS) && (JERRY_VM_STACK_SIZE == 0)
+#  error "Direct calls require a non-zero VM stack size"
+#endif
+
 /**
  * Wrap container types into a single guard
  */
@@ -0,0 +1,131 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-gc-policy.h"
+#include "jcontext.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmagcpolicy Adaptive garbage collection trigger
+ * @{
+ */
+
+#if ENABLED (JERRY_GC_ADAPTIVE_LIMIT)
+
+/**
+ * Smallest heap usage increase allowed between two garbage collections.
+ */
+#define ECMA_GC_POLICY_MIN_STEP JERRY_ALIGNUP (CONFIG_GC_LIMIT / 4, JMEM_ALIGNMENT)
+
+/**
+ * The mutator should run at least this many times longer than the garbage collector.
+ */
+#define ECMA_GC_POLICY_MUTATOR_RATIO 4
+
+/**
+ * Recompute the heap usage increase allowed until the next garbage collection.
+ *
+ * The step starts from the live heap size multiplied by the heap growth factor. It is doubled when
+ * most objects survived, because collecting again soon would free little memory, and it is increased
+ * when the mutator allocates so fast that the collections would take too much of the run time.
+ * Finally the step is limited so the estimated pause of the next collection stays below the target
+ * pause, assuming that the pause grows linearly with the size of the heap, and so half of the free
+ * heap remains available after the limit is reached.
+ */
+void
+ecma_gc_policy_update (double start_time, /**< start time of the garbage collection */
+                       size_t allocated_before, /**< allocated heap size before the garbage collection */
+                       size_t marked_objects, /**< number of objects which survived the garbage collection */
+                       size_t unmarked_objects) /**< number of objects found unreachable */
+{
+  const double end_time = jerry_port_get_current_time ();
+  const double pause_ms = end_time - start_time;
+
+  size_t live_size = JERRY_CONTEXT (jmem_heap_allocated_size);
+
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+  /* The unreachable objects are not freed yet, their share of the heap is estimated from their number. */
+  if (JERRY_CONTEXT (ecma_gc_objects_number) > 0)
+  {
+    live_size -= (size_t) ((double) live_size * (double) unmarked_objects
+                           / (double) JERRY_CONTEXT (ecma_gc_objects_number));
+  }
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
+
+  double step = (double) live_size * JERRY_GC_HEAP_GROWTH / 100.0;
+
+  if (marked_objects > 3 * unmarked_objects)
+  {
+    step *= 2;
+  }
+
+  const double elapsed_ms = start_time - JERRY_CONTEXT (ecma_gc_policy_last_time);
+
+  if (JERRY_CONTEXT (ecma_gc_policy_last_time) > 0
+      && elapsed_ms > 0
+      && pause_ms > 0
+      && allocated_before > JERRY_CONTEXT (ecma_gc_policy_live_size))
+  {
+    /* Bytes allocated per millisecond since the end of the previous collection. */
+    const double allocation_rate = (double) (allocated_before - JERRY_CONTEXT (ecma_gc_policy_live_size)) / elapsed_ms;
+    const double min_step = allocation_rate * pause_ms * ECMA_GC_POLICY_MUTATOR_RATIO;
+
+    if (step < min_step)
+    {
+      step = min_step;
+    }
+  }
+
+  if (pause_ms > 0 && allocated_before > 0)
+  {
+    const double max_heap_size = (double) allocated_before * (JERRY_GC_TARGET_PAUSE / 1000.0) / pause_ms;
+
+    if ((double) live_size + step > max_heap_size)
+    {
+      step = max_heap_size - (double) live_size;
+    }
+  }
+
+#if ENABLED (JERRY_SYSTEM_ALLOCATOR)
+  const size_t max_step = CONFIG_MEM_HEAP_SIZE / 4;
+#else /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+  /* Collections triggered by allocation failures are more expensive, because they run with high pressure. */
+  const size_t max_step = (live_size < JMEM_HEAP_SIZE) ? (JMEM_HEAP_SIZE - live_size) / 2 : 0;
+#endif /* ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+
+  size_t new_step = ECMA_GC_POLICY_MIN_STEP;
+
+  if (step > (double) max_step)
+  {
+    new_step = JERRY_MAX (JERRY_ALIGNUP (max_step, JMEM_ALIGNMENT), ECMA_GC_POLICY_MIN_STEP);
+  }
+  else if (step > (double) ECMA_GC_POLICY_MIN_STEP)
+  {
+    new_step = JERRY_ALIGNUP ((size_t) step, JMEM_ALIGNMENT);
+  }
+
+  JERRY_CONTEXT (jmem_heap_gc_step) = new_step;
+  JERRY_CONTEXT (jmem_heap_limit) = live_size + new_step;
+  JERRY_CONTEXT (ecma_gc_policy_live_size) = live_size;
+  JERRY_CONTEXT (ecma_gc_policy_last_time) = end_time;
+} /* ecma_gc_policy_update */
+
+#endif /* ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
+
+/**
+ * @}
+ * @}
+ */
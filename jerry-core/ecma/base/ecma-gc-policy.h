@@ -0,0 +1,38 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_GC_POLICY_H
+#define ECMA_GC_POLICY_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmagcpolicy Adaptive garbage collection trigger
+ * @{
+ */
+
+#if ENABLED (JERRY_GC_ADAPTIVE_LIMIT)
+void ecma_gc_policy_update (double start_time, size_t allocated_before, size_t marked_objects,
+                            size_t unmarked_objects);
+#endif /* ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_GC_POLICY_H */
@@ -23,10 +23,13 @@
 #include "ecma-function-object.h"
 #include "ecma-globals.h"
 #include "ecma-gc.h"
+#include "ecma-gc-policy.h"
 #include "ecma-helpers.h"
+#include "ecma-lcache.h"
 #include "ecma-objects.h"
 #include "ecma-property-hashmap.h"
 #include "ecma-proxy-object.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
@@ -84,36 +87,255 @@ ecma_gc_is_object_visited (ecma_object_t *object_p) /**< object */
  */
 static void ecma_gc_mark (ecma_object_t *object_p);
 
+#if ENABLED (JERRY_GC_PARALLEL_MARK)
+
+/**
+ * Minimum number of objects for which the mark phase of a full collection is run in parallel
+ */
+#define ECMA_GC_PARALLEL_MARK_MIN_OBJECTS 4096
+
+/**
+ * Gray object deque of the parallel marking worker run by the current thread,
+ * NULL - if the current thread does not run a worker
+ */
+static __thread ecma_gc_mark_deque_t *ecma_gc_mark_deque_p = NULL;
+
+/**
+ * Push an object onto the bottom of a gray object deque. Only the owner of the deque may push.
+ *
+ * @return true - if the object is pushed
+ *         false - if the deque is full
+ */
+static bool
+ecma_gc_mark_deque_push (ecma_gc_mark_deque_t *deque_p, /**< deque */
+                         jmem_cpointer_t object_cp) /**< object */
+{
+  uint32_t bottom = __atomic_load_n (&deque_p->bottom, __ATOMIC_RELAXED);
+  uint32_t top = __atomic_load_n (&deque_p->top, __ATOMIC_ACQUIRE);
+
+  if (bottom - top >= ECMA_GC_MARK_DEQUE_SIZE)
+  {
+    return false;
+  }
+
+  __atomic_store_n (deque_p->objects + (bottom & (ECMA_GC_MARK_DEQUE_SIZE - 1)), object_cp, __ATOMIC_RELAXED);
+  __atomic_store_n (&deque_p->bottom, bottom + 1, __ATOMIC_RELEASE);
+  return true;
+} /* ecma_gc_mark_deque_push */
+
+/**
+ * Set visited flag of the object on a parallel marking worker.
+ *
+ * The worker which changes the object from white to gray pushes it onto its own deque. When the deque
+ * is full, the object is left in the gray non-marked state like in ecma_gc_set_object_visited.
+ */
+static void
+ecma_gc_parallel_set_object_visited (ecma_object_t *object_p) /**< object */
+{
+  uint16_t type_flags_refs = __atomic_load_n (&object_p->type_flags_refs, __ATOMIC_RELAXED);
+
+  while (type_flags_refs >= ECMA_OBJECT_NON_VISITED)
+  {
+    /* Set the reference count of gray object to 0 */
+    uint16_t gray_flags_refs = (uint16_t) (type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
+
+    if (!__atomic_compare_exchange_n (&object_p->type_flags_refs,
+                                      &type_flags_refs,
+                                      gray_flags_refs,
+                                      false,
+                                      __ATOMIC_RELAXED,
+                                      __ATOMIC_RELAXED))
+    {
+      /* Another worker has visited the object, or the loaded value is stale. */
+      continue;
+    }
+
+    jmem_cpointer_t object_cp;
+    ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+    if (!ecma_gc_mark_deque_push (ecma_gc_mark_deque_p, object_cp))
+    {
+      /* Set the reference count of the non-marked gray object to 1. The other workers
+       * do not change the object anymore, since it is visited. */
+      __atomic_store_n (&object_p->type_flags_refs, (uint16_t) (gray_flags_refs | ECMA_OBJECT_REF_ONE),
+                        __ATOMIC_RELAXED);
+      __atomic_fetch_or (&JERRY_CONTEXT (status_flags), (uint32_t) ECMA_STATUS_GC_MARK_OVERFLOW, __ATOMIC_RELAXED);
+    }
+    return;
+  }
+} /* ecma_gc_parallel_set_object_visited */
+
+#endif /* ENABLED (JERRY_GC_PARALLEL_MARK) */
+
 /**
  * Set visited flag of the object.
+ *
+ * Newly visited (gray) objects are pushed onto the gray object worklist. When the worklist is
+ * full, the object is left in the gray non-marked state and is picked up later by a rescan
+ * of the white/gray object list.
  */
 static void
 ecma_gc_set_object_visited (ecma_object_t *object_p) /**< object */
 {
+#if ENABLED (JERRY_GC_PARALLEL_MARK)
+  if (ecma_gc_mark_deque_p != NULL)
+  {
+    ecma_gc_parallel_set_object_visited (object_p);
+    return;
+  }
+#endif /* ENABLED (JERRY_GC_PARALLEL_MARK) */
+
   if (object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED)
   {
-#if (JERRY_GC_MARK_LIMIT != 0)
-    if (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) != 0)
+#if ENABLED (JERRY_GC_INCREMENTAL)
+    if (JERRY_CONTEXT (ecma_gc_incremental_state) == ECMA_GC_INCREMENTAL_MARK)
     {
-      JERRY_CONTEXT (ecma_gc_mark_recursion_limit)--;
+      /* The incremental worklist is large enough to hold every object existing at the start of the cycle. */
+      JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_incremental_stack_top) < JERRY_CONTEXT (ecma_gc_incremental_stack_size));
+
       /* Set the reference count of gray object to 0 */
       object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
-      ecma_gc_mark (object_p);
-      JERRY_CONTEXT (ecma_gc_mark_recursion_limit)++;
+      uint32_t top = JERRY_CONTEXT (ecma_gc_incremental_stack_top)++;
+      ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_incremental_stack_p)[top], object_p);
+      return;
     }
-    else
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
+#if (JERRY_GC_MARK_LIMIT != 0)
+    if (JERRY_CONTEXT (ecma_gc_mark_stack_top) < JERRY_GC_MARK_LIMIT)
     {
-      /* Set the reference count of the non-marked gray object to 1 */
-      object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & ((ECMA_OBJECT_REF_ONE << 1) - 1));
-      JERRY_ASSERT (object_p->type_flags_refs >= ECMA_OBJECT_REF_ONE);
+      /* Set the reference count of gray object to 0 */
+      object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
+      ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_mark_stack)[JERRY_CONTEXT (ecma_gc_mark_stack_top)],
+                                 object_p);
+      JERRY_CONTEXT (ecma_gc_mark_stack_top)++;
+      return;
     }
-#else /* (JERRY_GC_MARK_LIMIT == 0) */
-    /* Set the reference count of gray object to 0 */
-    object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
 #endif /* (JERRY_GC_MARK_LIMIT != 0) */
+
+    /* Set the reference count of the non-marked gray object to 1 */
+    object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & ((ECMA_OBJECT_REF_ONE << 1) - 1));
+    JERRY_ASSERT (object_p->type_flags_refs >= ECMA_OBJECT_REF_ONE);
+    JERRY_CONTEXT (status_flags) |= ECMA_STATUS_GC_MARK_OVERFLOW;
   }
 } /* ecma_gc_set_object_visited */
 
+#if ENABLED (JERRY_GC_GENERATIONAL)
+
+/**
+ * Number of words of the generational bitmaps, which have one bit for each heap unit.
+ */
+#define ECMA_GC_BITMAP_WORDS ((uint32_t) ((JMEM_HEAP_AREA_SIZE / JMEM_ALIGNMENT + 31) / 32))
+
+/**
+ * Get the generational bitmap index of an object.
+ */
+#define ECMA_GC_BITMAP_INDEX(object_p) \
+  ((uint32_t) (((uint8_t *) (object_p) - JERRY_HEAP_CONTEXT (area)) >> JMEM_ALIGNMENT_LOG))
+
+/**
+ * Get the bit of an object from a generational bitmap.
+ *
+ * @return true  - if the bit is set
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_bitmap_get (const uint32_t *bitmap_p, /**< bitmap */
+                    ecma_object_t *object_p) /**< object */
+{
+  uint32_t index = ECMA_GC_BITMAP_INDEX (object_p);
+
+  return (bitmap_p[index >> 5] & ((uint32_t) 1 << (index & 0x1f))) != 0;
+} /* ecma_gc_bitmap_get */
+
+/**
+ * Set the bit of an object in a generational bitmap.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_bitmap_set (uint32_t *bitmap_p, /**< bitmap */
+                    ecma_object_t *object_p) /**< object */
+{
+  uint32_t index = ECMA_GC_BITMAP_INDEX (object_p);
+
+  bitmap_p[index >> 5] |= (uint32_t) 1 << (index & 0x1f);
+} /* ecma_gc_bitmap_set */
+
+/**
+ * Clear the bit of an object in a generational bitmap.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_bitmap_clear (uint32_t *bitmap_p, /**< bitmap */
+                      ecma_object_t *object_p) /**< object */
+{
+  uint32_t index = ECMA_GC_BITMAP_INDEX (object_p);
+
+  bitmap_p[index >> 5] &= ~((uint32_t) 1 << (index & 0x1f));
+} /* ecma_gc_bitmap_clear */
+
+/**
+ * Add an old object to the remembered set, since it may refer to young objects.
+ */
+void
+ecma_gc_remember_object (ecma_object_t *object_p) /**< object */
+{
+  if (!ecma_gc_bitmap_get (JERRY_CONTEXT (ecma_gc_young_bitmap_p), object_p))
+  {
+    ecma_gc_bitmap_set (JERRY_CONTEXT (ecma_gc_remembered_bitmap_p), object_p);
+  }
+} /* ecma_gc_remember_object */
+
+/**
+ * Write barrier of the generational collector: an old object which receives a reference
+ * to a young object is added to the remembered set.
+ */
+void
+ecma_gc_generational_write_barrier (ecma_object_t *object_p, /**< object which receives the reference */
+                                    ecma_object_t *value_p) /**< referenced object */
+{
+  if (ecma_gc_bitmap_get (JERRY_CONTEXT (ecma_gc_young_bitmap_p), value_p))
+  {
+    ecma_gc_remember_object (object_p);
+  }
+} /* ecma_gc_generational_write_barrier */
+
+/**
+ * Allocate the bitmaps of the generational collector.
+ */
+void
+ecma_gc_generational_init (void)
+{
+  size_t bitmap_size = ECMA_GC_BITMAP_WORDS * sizeof (uint32_t);
+  uint32_t *bitmaps_p = (uint32_t *) jmem_heap_alloc_block (2 * bitmap_size);
+
+  memset (bitmaps_p, 0, 2 * bitmap_size);
+  JERRY_CONTEXT (ecma_gc_young_bitmap_p) = bitmaps_p;
+  JERRY_CONTEXT (ecma_gc_remembered_bitmap_p) = bitmaps_p + ECMA_GC_BITMAP_WORDS;
+} /* ecma_gc_generational_init */
+
+/**
+ * Free the bitmaps of the generational collector.
+ */
+void
+ecma_gc_generational_finalize (void)
+{
+  jmem_heap_free_block (JERRY_CONTEXT (ecma_gc_young_bitmap_p), 2 * ECMA_GC_BITMAP_WORDS * sizeof (uint32_t));
+  JERRY_CONTEXT (ecma_gc_young_bitmap_p) = NULL;
+  JERRY_CONTEXT (ecma_gc_remembered_bitmap_p) = NULL;
+} /* ecma_gc_generational_finalize */
+
+/**
+ * Move every object to the old generation and clear the remembered set before a full collection.
+ * The collection adds the root objects to the remembered set again.
+ */
+static void
+ecma_gc_generational_reset (void)
+{
+  memset (JERRY_CONTEXT (ecma_gc_young_bitmap_p), 0, 2 * ECMA_GC_BITMAP_WORDS * sizeof (uint32_t));
+  JERRY_CONTEXT (ecma_gc_promoted_objects) = 0;
+} /* ecma_gc_generational_reset */
+
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
 /**
  * Initialize GC information for the object
  */
@@ -126,6 +348,19 @@ ecma_init_gc_info (ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (object_p->type_flags_refs < ECMA_OBJECT_REF_ONE);
   object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs | ECMA_OBJECT_REF_ONE);
 
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  uint32_t *bitmap_p = JERRY_CONTEXT (ecma_gc_young_bitmap_p);
+#if ENABLED (JERRY_GC_INCREMENTAL)
+  if (JERRY_CONTEXT (ecma_gc_incremental_state) != ECMA_GC_INCREMENTAL_IDLE)
+  {
+    /* Objects created during an incremental cycle are old, and they are remembered
+     * while they are referenced, since they can be modified without a write barrier. */
+    bitmap_p = JERRY_CONTEXT (ecma_gc_remembered_bitmap_p);
+  }
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+  ecma_gc_bitmap_set (bitmap_p, object_p);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
   object_p->gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
   ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_objects_cp), object_p);
 #if defined(JERRY_REF_TRACKER)
@@ -143,10 +378,25 @@ ecma_ref_object (ecma_object_t *object_p) /**< object */
   {
     object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs + ECMA_OBJECT_REF_ONE);
   }
+#if ENABLED (JERRY_GC_INCREMENTAL)
+  else if (object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED)
+  {
+    /* An unmarked object gets referenced while incremental marking is in progress, so it must be kept alive. */
+    JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_incremental_state) == ECMA_GC_INCREMENTAL_MARK);
+
+    ecma_gc_set_object_visited (object_p);
+    object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs + ECMA_OBJECT_REF_ONE);
+  }
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
   else
   {
     jerry_fatal (ERR_REF_COUNT_LIMIT);
   }
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  /* Referenced objects can be modified without a write barrier. */
+  ecma_gc_remember_object (object_p);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
 #if defined(JERRY_REF_TRACKER)
   ReportObjRefManip(object_p, kRefRef);
 #endif
@@ -182,17 +432,19 @@ ecma_deref_object (ecma_object_t *object_p) /**< object */
  * Mark referenced object from property
  */
 static inline void JERRY_ATTR_ALWAYS_INLINE
-ecma_gc_mark_properties (ecma_property_pair_t *property_pair_p) /**< property pair */
+ecma_gc_mark_properties (ecma_property_header_t *property_header_p, /**< property pair header */
+                         ecma_property_value_t *values_p, /**< property values */
+                         const jmem_cpointer_t *names_cp) /**< property names */
 {
   for (uint32_t index = 0; index < ECMA_PROPERTY_PAIR_ITEM_COUNT; index++)
   {
-    uint8_t property = property_pair_p->header.types[index];
+    uint8_t property = property_header_p->types[index];
 
     switch (ECMA_PROPERTY_GET_TYPE (property))
     {
       case ECMA_PROPERTY_TYPE_NAMEDDATA:
       {
-        ecma_value_t value = property_pair_p->values[index].value;
+        ecma_value_t value = values_p[index].value;
 
         if (ecma_is_value_object (value))
         {
@@ -204,7 +456,7 @@ ecma_gc_mark_properties (ecma_property_pair_t *property_pair_p) /**< property pa
       }
       case ECMA_PROPERTY_TYPE_NAMEDACCESSOR:
       {
-        ecma_property_value_t *accessor_objs_p = property_pair_p->values + index;
+        ecma_property_value_t *accessor_objs_p = values_p + index;
 
         ecma_getter_setter_pointers_t *get_set_pair_p = ecma_get_named_accessor_property (accessor_objs_p);
 
@@ -222,7 +474,8 @@ ecma_gc_mark_properties (ecma_property_pair_t *property_pair_p) /**< property pa
       case ECMA_PROPERTY_TYPE_INTERNAL:
       {
         JERRY_ASSERT (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_MAGIC
-                      && property_pair_p->names_cp[index] >= LIT_FIRST_INTERNAL_MAGIC_STRING);
+                      && names_cp[index] >= LIT_FIRST_INTERNAL_MAGIC_STRING);
+        JERRY_UNUSED (names_cp);
         break;
       }
       default:
@@ -757,28 +1010,298 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
 
   jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
 
-#if ENABLED (JERRY_PROPRETY_HASHMAP)
+#if ENABLED (JERRY_PROPRETY_HASHMAP) || ENABLED (JERRY_OBJECT_SHAPES)
   if (prop_iter_cp != JMEM_CP_NULL)
   {
     ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+#if ENABLED (JERRY_PROPRETY_HASHMAP)
     if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
     {
       prop_iter_cp = prop_iter_p->next_property_cp;
     }
-  }
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
+#if ENABLED (JERRY_OBJECT_SHAPES)
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+    {
+      ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, prop_iter_p->next_property_cp);
+      ecma_shape_slot_pair_t *slot_pairs_p = ECMA_SHAPE_GET_SLOT_PAIRS (prop_iter_p);
+      jmem_cpointer_t *names_p = ECMA_SHAPE_GET_NAMES (shape_p);
+      uint32_t slot_pair_count = ECMA_SHAPE_GET_SLOT_PAIR_COUNT (shape_p->property_count);
+
+      for (uint32_t i = 0; i < slot_pair_count; i++)
+      {
+        ecma_gc_mark_properties (&slot_pairs_p[i].header, slot_pairs_p[i].values, names_p + i * 2);
+      }
+      return;
+    }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+  }
+#endif /* ENABLED (JERRY_PROPRETY_HASHMAP) || ENABLED (JERRY_OBJECT_SHAPES) */
 
   while (prop_iter_cp != JMEM_CP_NULL)
   {
     ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
     JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
 
-    ecma_gc_mark_properties ((ecma_property_pair_t *) prop_iter_p);
+    ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+    ecma_gc_mark_properties (&prop_pair_p->header, prop_pair_p->values, prop_pair_p->names_cp);
 
     prop_iter_cp = prop_iter_p->next_property_cp;
   }
 } /* ecma_gc_mark */
 
+/**
+ * Mark the objects stored on the gray object worklist until the worklist becomes empty.
+ */
+static void
+ecma_gc_mark_worklist (void)
+{
+#if (JERRY_GC_MARK_LIMIT != 0)
+  while (JERRY_CONTEXT (ecma_gc_mark_stack_top) > 0)
+  {
+    uint32_t top = --JERRY_CONTEXT (ecma_gc_mark_stack_top);
+    ecma_object_t *object_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_mark_stack)[top]);
+
+    ecma_gc_mark (object_p);
+#if defined(JERRY_HEAPDUMP)
+    if (GetHeapdumpTracing()) {
+      DumpInfoObject(object_p, HEAPDUMP_OBJECT_SIMPLE);
+    }
+#endif
+  }
+#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+} /* ecma_gc_mark_worklist */
+
+/**
+ * Mark the gray objects which did not fit into the worklist. Each object is marked exactly
+ * once, so the list is only rescanned while the worklist keeps overflowing.
+ */
+static void
+ecma_gc_mark_overflowed_objects (jmem_cpointer_t white_gray_list_cp) /**< list of white and gray objects */
+{
+  while (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_MARK_OVERFLOW)
+  {
+    JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_GC_MARK_OVERFLOW;
+
+    jmem_cpointer_t obj_iter_cp = white_gray_list_cp;
+
+    while (obj_iter_cp != JMEM_CP_NULL)
+    {
+      ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+      if (ecma_gc_is_object_visited (obj_iter_p)
+          && obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+      {
+        /* Set the reference count of non-marked gray object to 0 */
+        obj_iter_p->type_flags_refs = (uint16_t) (obj_iter_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
+        ecma_gc_mark (obj_iter_p);
+#if defined(JERRY_HEAPDUMP)
+        if (GetHeapdumpTracing()) {
+          DumpInfoObject(obj_iter_p, HEAPDUMP_OBJECT_SIMPLE);
+        }
+#endif
+        ecma_gc_mark_worklist ();
+      }
+
+      obj_iter_cp = obj_iter_p->gc_next_cp;
+    }
+  }
+} /* ecma_gc_mark_overflowed_objects */
+
+#if ENABLED (JERRY_GC_PARALLEL_MARK)
+
+/**
+ * Pop an object from the bottom of a gray object deque. Only the owner of the deque may pop.
+ *
+ * @return true - if an object is popped
+ *         false - if the deque is empty
+ */
+static bool
+ecma_gc_mark_deque_pop (ecma_gc_mark_deque_t *deque_p, /**< deque */
+                        jmem_cpointer_t *object_cp_p) /**< [out] object */
+{
+  uint32_t bottom = __atomic_load_n (&deque_p->bottom, __ATOMIC_RELAXED) - 1;
+  __atomic_store_n (&deque_p->bottom, bottom, __ATOMIC_RELAXED);
+  __atomic_thread_fence (__ATOMIC_SEQ_CST);
+  uint32_t top = __atomic_load_n (&deque_p->top, __ATOMIC_RELAXED);
+
+  if ((int32_t) (bottom - top) < 0)
+  {
+    __atomic_store_n (&deque_p->bottom, bottom + 1, __ATOMIC_RELAXED);
+    return false;
+  }
+
+  *object_cp_p = __atomic_load_n (deque_p->objects + (bottom & (ECMA_GC_MARK_DEQUE_SIZE - 1)), __ATOMIC_RELAXED);
+
+  if (bottom != top)
+  {
+    return true;
+  }
+
+  /* The last object may be stolen at the same time. */
+  bool is_popped = __atomic_compare_exchange_n (&deque_p->top, &top, top + 1, false,
+                                                __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+  __atomic_store_n (&deque_p->bottom, bottom + 1, __ATOMIC_RELAXED);
+  return is_popped;
+} /* ecma_gc_mark_deque_pop */
+
+/**
+ * Steal an object from the top of a gray object deque.
+ *
+ * @return true - if an object is stolen
+ *         false - if the deque is empty, or another worker took the object first
+ */
+static bool
+ecma_gc_mark_deque_steal (ecma_gc_mark_deque_t *deque_p, /**< deque */
+                          jmem_cpointer_t *object_cp_p) /**< [out] object */
+{
+  uint32_t top = __atomic_load_n (&deque_p->top, __ATOMIC_ACQUIRE);
+  __atomic_thread_fence (__ATOMIC_SEQ_CST);
+  uint32_t bottom = __atomic_load_n (&deque_p->bottom, __ATOMIC_ACQUIRE);
+
+  if ((int32_t) (bottom - top) <= 0)
+  {
+    return false;
+  }
+
+  *object_cp_p = __atomic_load_n (deque_p->objects + (top & (ECMA_GC_MARK_DEQUE_SIZE - 1)), __ATOMIC_RELAXED);
+
+  return __atomic_compare_exchange_n (&deque_p->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+} /* ecma_gc_mark_deque_steal */
+
+/**
+ * Check whether any gray object deque holds objects.
+ *
+ * @return true - if there are gray objects on the deques
+ *         false - otherwise
+ */
+static bool
+ecma_gc_mark_deques_have_objects (void)
+{
+  ecma_gc_mark_deque_t *deques_p = JERRY_CONTEXT (ecma_gc_mark_deques);
+
+  for (uint32_t i = 0; i < JERRY_GC_MARK_THREADS; i++)
+  {
+    uint32_t top = __atomic_load_n (&deques_p[i].top, __ATOMIC_SEQ_CST);
+    uint32_t bottom = __atomic_load_n (&deques_p[i].bottom, __ATOMIC_SEQ_CST);
+
+    if ((int32_t) (bottom - top) > 0)
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* ecma_gc_mark_deques_have_objects */
+
+/**
+ * Parallel marking worker: marks the objects of its own deque, and steals objects from the other
+ * deques when its own deque is empty. The worker returns when no worker can produce gray objects
+ * anymore, i.e. every worker is idle and every deque is empty.
+ */
+static void
+ecma_gc_parallel_mark_worker (void *data_p, /**< unused */
+                              uint32_t worker_index) /**< index of the worker */
+{
+  JERRY_UNUSED (data_p);
+
+  if (worker_index >= JERRY_GC_MARK_THREADS)
+  {
+    return;
+  }
+
+  ecma_gc_mark_deque_t *deques_p = JERRY_CONTEXT (ecma_gc_mark_deques);
+  uint32_t *active_workers_p = &JERRY_CONTEXT (ecma_gc_mark_active_workers);
+  jmem_cpointer_t object_cp;
+
+  ecma_gc_mark_deque_p = deques_p + worker_index;
+  __atomic_fetch_add (active_workers_p, 1, __ATOMIC_SEQ_CST);
+
+  while (true)
+  {
+    bool has_object = ecma_gc_mark_deque_pop (ecma_gc_mark_deque_p, &object_cp);
+
+    for (uint32_t i = 1; !has_object && i < JERRY_GC_MARK_THREADS; i++)
+    {
+      has_object = ecma_gc_mark_deque_steal (deques_p + ((worker_index + i) % JERRY_GC_MARK_THREADS), &object_cp);
+    }
+
+    if (has_object)
+    {
+      ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, object_cp));
+      continue;
+    }
+
+    __atomic_fetch_sub (active_workers_p, 1, __ATOMIC_SEQ_CST);
+
+    while (!ecma_gc_mark_deques_have_objects ())
+    {
+      /* The objects pushed by an active worker are checked after the worker becomes idle. */
+      if (__atomic_load_n (active_workers_p, __ATOMIC_SEQ_CST) == 0
+          && !ecma_gc_mark_deques_have_objects ())
+      {
+        ecma_gc_mark_deque_p = NULL;
+        return;
+      }
+    }
+
+    __atomic_fetch_add (active_workers_p, 1, __ATOMIC_SEQ_CST);
+  }
+} /* ecma_gc_parallel_mark_worker */
+
+/**
+ * Mark the root objects and the objects reachable from them by parallel workers.
+ *
+ * Note:
+ *      the mark phase is only run in parallel for large heaps, and at most half of each deque
+ *      is filled with root objects, the remaining root objects must be marked by the caller
+ *
+ * @return first root object which is not marked
+ */
+static jmem_cpointer_t
+ecma_gc_parallel_mark (jmem_cpointer_t root_cp) /**< first root object */
+{
+  if (JERRY_CONTEXT (ecma_gc_objects_number) < ECMA_GC_PARALLEL_MARK_MIN_OBJECTS
+#if defined(JERRY_HEAPDUMP)
+      || GetHeapdumpTracing ()
+#endif
+     )
+  {
+    return root_cp;
+  }
+
+  ecma_gc_mark_deque_t *deques_p = JERRY_CONTEXT (ecma_gc_mark_deques);
+
+  for (uint32_t i = 0; i < JERRY_GC_MARK_THREADS; i++)
+  {
+    deques_p[i].top = 0;
+    deques_p[i].bottom = 0;
+  }
+
+  /* Distribute the root objects among the workers. */
+  uint32_t worker_index = 0;
+
+  while (root_cp != JMEM_CP_NULL && deques_p[worker_index].bottom < ECMA_GC_MARK_DEQUE_SIZE / 2)
+  {
+    ecma_gc_mark_deque_t *deque_p = deques_p + worker_index;
+
+    deque_p->objects[deque_p->bottom++] = root_cp;
+    root_cp = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, root_cp)->gc_next_cp;
+    worker_index = (worker_index + 1) % JERRY_GC_MARK_THREADS;
+  }
+
+  JERRY_CONTEXT (ecma_gc_mark_active_workers) = 0;
+  jerry_port_run_parallel (ecma_gc_parallel_mark_worker, NULL, JERRY_GC_MARK_THREADS);
+
+  /* Finish the work of the workers which were not started by the port. */
+  ecma_gc_parallel_mark_worker (NULL, 0);
+  JERRY_ASSERT (!ecma_gc_mark_deques_have_objects ());
+
+  return root_cp;
+} /* ecma_gc_parallel_mark */
+
+#endif /* ENABLED (JERRY_GC_PARALLEL_MARK) */
+
 /**
  * Free the native handle/pointer by calling its free callback.
  */
@@ -954,9 +1477,17 @@ ecma_gc_free_properties (ecma_object_t *object_p) /**< object */
   }
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
-  while (prop_iter_cp != JMEM_CP_NULL)
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ecma_object_has_shape (object_p))
   {
-    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+    ecma_shape_free_properties (object_p);
+    return;
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+  while (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
     JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
 
     /* Both cannot be deleted. */
@@ -1024,6 +1555,11 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
   JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_objects_number) > 0);
   JERRY_CONTEXT (ecma_gc_objects_number)--;
 
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  ecma_gc_bitmap_clear (JERRY_CONTEXT (ecma_gc_young_bitmap_p), object_p);
+  ecma_gc_bitmap_clear (JERRY_CONTEXT (ecma_gc_remembered_bitmap_p), object_p);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
   if (ecma_is_lexical_environment (object_p))
   {
     if (ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
@@ -1342,6 +1878,184 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
   ecma_dealloc_extended_object (object_p, ext_object_size);
 } /* ecma_gc_free_object */
 
+#if ENABLED (JERRY_GC_INCREMENTAL)
+
+/**
+ * Start an incremental collection cycle: the root objects become gray, all other objects become white.
+ *
+ * @return true - if the cycle is started
+ *         false - if there is not enough memory for the gray object worklist
+ */
+static bool
+ecma_gc_incremental_start (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_incremental_state) == ECMA_GC_INCREMENTAL_IDLE);
+
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+  ecma_gc_finish_lazy_sweep ();
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
+
+  /* Every object is pushed at most once, and objects created during the cycle are never white. */
+  uint32_t stack_size = (uint32_t) JERRY_CONTEXT (ecma_gc_objects_number) + 1;
+  jmem_cpointer_t *stack_p;
+  stack_p = (jmem_cpointer_t *) jmem_heap_alloc_block_null_on_error (stack_size * sizeof (jmem_cpointer_t));
+
+  if (stack_p == NULL)
+  {
+    return false;
+  }
+
+  JERRY_CONTEXT (ecma_gc_new_objects) = 0;
+  JERRY_CONTEXT (ecma_gc_incremental_stack_p) = stack_p;
+  JERRY_CONTEXT (ecma_gc_incremental_stack_size) = stack_size;
+  JERRY_CONTEXT (ecma_gc_incremental_stack_top) = 0;
+  JERRY_CONTEXT (ecma_gc_incremental_state) = ECMA_GC_INCREMENTAL_MARK;
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  ecma_gc_generational_reset ();
+  JERRY_CONTEXT (ecma_gc_old_objects_cp) = JERRY_CONTEXT (ecma_gc_objects_cp);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
+  jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+    if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+    {
+      JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_incremental_stack_top) < stack_size);
+      stack_p[JERRY_CONTEXT (ecma_gc_incremental_stack_top)++] = obj_iter_cp;
+#if ENABLED (JERRY_GC_GENERATIONAL)
+      ecma_gc_bitmap_set (JERRY_CONTEXT (ecma_gc_remembered_bitmap_p), obj_iter_p);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+    }
+    else
+    {
+      obj_iter_p->type_flags_refs |= ECMA_OBJECT_NON_VISITED;
+    }
+
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+  }
+
+  return true;
+} /* ecma_gc_incremental_start */
+
+/**
+ * Perform incremental collection work until the cycle is finished or the deadline is reached.
+ *
+ * @return true - if the collection cycle is not finished yet
+ *         false - otherwise
+ */
+static bool
+ecma_gc_incremental_advance (const double *deadline_p) /**< deadline in milliseconds,
+                                                        *   NULL - finish the current cycle */
+{
+  uint32_t work_count = 0;
+
+  while (true)
+  {
+    if (JERRY_CONTEXT (ecma_gc_incremental_state) == ECMA_GC_INCREMENTAL_MARK)
+    {
+      if (JERRY_CONTEXT (ecma_gc_incremental_stack_top) > 0)
+      {
+        uint32_t top = --JERRY_CONTEXT (ecma_gc_incremental_stack_top);
+        ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_incremental_stack_p)[top]));
+      }
+      else
+      {
+        /* Marking is finished: objects allocated from now on are kept on a separate list until
+         * the unswept objects are processed. */
+        jmem_heap_free_block (JERRY_CONTEXT (ecma_gc_incremental_stack_p),
+                              JERRY_CONTEXT (ecma_gc_incremental_stack_size) * sizeof (jmem_cpointer_t));
+        JERRY_CONTEXT (ecma_gc_incremental_stack_p) = NULL;
+        JERRY_CONTEXT (ecma_gc_incremental_stack_size) = 0;
+
+        JERRY_CONTEXT (ecma_gc_sweep_objects_cp) = JERRY_CONTEXT (ecma_gc_objects_cp);
+        JERRY_CONTEXT (ecma_gc_objects_cp) = JMEM_CP_NULL;
+        JERRY_CONTEXT (ecma_gc_incremental_state) = ECMA_GC_INCREMENTAL_SWEEP;
+        JERRY_CONTEXT (ecma_gc_incremental_marked) = 0;
+        JERRY_CONTEXT (ecma_gc_incremental_swept) = 0;
+      }
+    }
+    else
+    {
+      JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_incremental_state) == ECMA_GC_INCREMENTAL_SWEEP);
+
+      jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_sweep_objects_cp);
+
+      if (obj_iter_cp == JMEM_CP_NULL)
+      {
+        JERRY_CONTEXT (ecma_gc_incremental_state) = ECMA_GC_INCREMENTAL_IDLE;
+        jmem_telemetry_gc_cycle (JERRY_CONTEXT (ecma_gc_incremental_marked),
+                                 JERRY_CONTEXT (ecma_gc_incremental_swept));
+#if ENABLED (JERRY_GC_GENERATIONAL)
+        /* Objects created during the cycle belong to the old generation. */
+        JERRY_CONTEXT (ecma_gc_old_objects_cp) = JERRY_CONTEXT (ecma_gc_objects_cp);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+        /* Free RegExp bytecodes stored in cache */
+        re_cache_gc ();
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+        return false;
+      }
+
+      ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+      JERRY_CONTEXT (ecma_gc_sweep_objects_cp) = obj_iter_p->gc_next_cp;
+
+      if (ecma_gc_is_object_visited (obj_iter_p))
+      {
+        obj_iter_p->gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+        JERRY_CONTEXT (ecma_gc_objects_cp) = obj_iter_cp;
+        JERRY_CONTEXT (ecma_gc_incremental_marked)++;
+      }
+      else
+      {
+        ecma_gc_free_object (obj_iter_p);
+        JERRY_CONTEXT (ecma_gc_incremental_swept)++;
+      }
+    }
+
+    if (deadline_p != NULL
+        && (++work_count % ECMA_GC_INCREMENTAL_WORK_UNIT) == 0
+        && jerry_port_get_current_time () >= *deadline_p)
+    {
+      return true;
+    }
+  }
+} /* ecma_gc_incremental_advance */
+
+/**
+ * Write barrier of the incremental collector: the stored object is marked as visited,
+ * since the object which receives it may have been marked already.
+ */
+void
+ecma_gc_write_barrier (ecma_value_t value) /**< stored value */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_incremental_state) == ECMA_GC_INCREMENTAL_MARK);
+
+  if (ecma_is_value_object (value))
+  {
+    ecma_gc_set_object_visited (ecma_get_object_from_value (value));
+  }
+} /* ecma_gc_write_barrier */
+
+/**
+ * Free the remaining unmarked objects of the current incremental collection cycle,
+ * so the list of the live objects becomes complete again.
+ */
+void
+ecma_gc_finish_incremental_sweep (void)
+{
+  if (JERRY_CONTEXT (ecma_gc_incremental_state) == ECMA_GC_INCREMENTAL_SWEEP)
+  {
+    ecma_gc_incremental_advance (NULL);
+  }
+} /* ecma_gc_finish_incremental_sweep */
+
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
 bool g_isGCEnabled = true;
 void EnableGC()
 {
@@ -1361,8 +2075,9 @@ void
 ecma_gc_run (void)
 {
 #if (JERRY_GC_MARK_LIMIT != 0)
-  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) == JERRY_GC_MARK_LIMIT);
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_stack_top) == 0);
 #endif /* (JERRY_GC_MARK_LIMIT != 0) */
+  JERRY_ASSERT (!(JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_MARK_OVERFLOW));
 
   JERRY_CONTEXT (ecma_gc_new_objects) = 0;
 
@@ -1370,6 +2085,32 @@ ecma_gc_run (void)
     return;
   }
 
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+  /* The weak references of the pending objects must be removed before marking. */
+  ecma_gc_finish_lazy_sweep ();
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
+
+  double start_time = jerry_port_get_current_time ();
+
+#if ENABLED (JERRY_GC_INCREMENTAL)
+  if (JERRY_CONTEXT (ecma_gc_incremental_state) != ECMA_GC_INCREMENTAL_IDLE)
+  {
+    /* Complete the pending cycle, then collect the objects which died during the cycle as well. */
+    ecma_gc_incremental_advance (NULL);
+    JERRY_CONTEXT (ecma_gc_new_objects) = 0;
+  }
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  ecma_gc_generational_reset ();
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
+#if ENABLED (JERRY_GC_ADAPTIVE_LIMIT)
+  const size_t allocated_before = JERRY_CONTEXT (jmem_heap_allocated_size);
+#endif /* ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
+  const size_t objects_before = JERRY_CONTEXT (ecma_gc_objects_number);
+  size_t unmarked_objects = 0;
+
   ecma_object_t black_list_head;
   black_list_head.gc_next_cp = JMEM_CP_NULL;
   ecma_object_t *black_end_p = &black_list_head;
@@ -1397,6 +2138,10 @@ ecma_gc_run (void)
 
       black_end_p->gc_next_cp = obj_iter_cp;
       black_end_p = obj_iter_p;
+#if ENABLED (JERRY_GC_GENERATIONAL)
+      /* Referenced objects can be modified without a write barrier. */
+      ecma_gc_bitmap_set (JERRY_CONTEXT (ecma_gc_remembered_bitmap_p), obj_iter_p);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
     }
     else
     {
@@ -1411,6 +2156,9 @@ ecma_gc_run (void)
 
   /* Mark root objects. */
   obj_iter_cp = black_list_head.gc_next_cp;
+#if ENABLED (JERRY_GC_PARALLEL_MARK)
+  obj_iter_cp = ecma_gc_parallel_mark (obj_iter_cp);
+#endif /* ENABLED (JERRY_GC_PARALLEL_MARK) */
   while (obj_iter_cp != JMEM_CP_NULL)
   {
     obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
@@ -1420,70 +2168,249 @@ ecma_gc_run (void)
       DumpInfoObject(obj_iter_p, HEAPDUMP_OBJECT_ROOT);
     }
 #endif
+    ecma_gc_mark_worklist ();
     obj_iter_cp = obj_iter_p->gc_next_cp;
   }
 
-  /* Mark non-root objects. */
-  bool marked_anything_during_current_iteration;
+  ecma_gc_mark_overflowed_objects (white_gray_list_head.gc_next_cp);
 
-  do
+  /* Move the visited objects to the list of marked objects. */
+  obj_prev_p = &white_gray_list_head;
+  obj_iter_cp = obj_prev_p->gc_next_cp;
+
+  while (obj_iter_cp != JMEM_CP_NULL)
   {
-#if (JERRY_GC_MARK_LIMIT != 0)
-    JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) == JERRY_GC_MARK_LIMIT);
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
 
-    marked_anything_during_current_iteration = false;
+    JERRY_ASSERT (obj_prev_p == NULL
+                  || ECMA_GET_NON_NULL_POINTER (ecma_object_t, obj_prev_p->gc_next_cp) == obj_iter_p);
+
+    if (ecma_gc_is_object_visited (obj_iter_p))
+    {
+      JERRY_ASSERT (obj_iter_p->type_flags_refs < ECMA_OBJECT_REF_ONE);
 
-    obj_prev_p = &white_gray_list_head;
-    obj_iter_cp = obj_prev_p->gc_next_cp;
+      obj_prev_p->gc_next_cp = obj_next_cp;
 
-    while (obj_iter_cp != JMEM_CP_NULL)
+      black_end_p->gc_next_cp = obj_iter_cp;
+      black_end_p = obj_iter_p;
+    }
+    else
     {
-      obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
-      const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+      obj_prev_p = obj_iter_p;
+      unmarked_objects++;
+    }
 
-      JERRY_ASSERT (obj_prev_p == NULL
-                    || ECMA_GET_NON_NULL_POINTER (ecma_object_t, obj_prev_p->gc_next_cp) == obj_iter_p);
+    obj_iter_cp = obj_next_cp;
+  }
 
-      if (ecma_gc_is_object_visited (obj_iter_p))
-      {
-        /* Moving the object to list of marked objects */
-        obj_prev_p->gc_next_cp = obj_next_cp;
+  black_end_p->gc_next_cp = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_objects_cp) = black_list_head.gc_next_cp;
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  JERRY_CONTEXT (ecma_gc_old_objects_cp) = JERRY_CONTEXT (ecma_gc_objects_cp);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+  /* The unmarked objects are freed later by the allocator or by jerry_gc_sweep_step. */
+  JERRY_CONTEXT (ecma_gc_lazy_sweep_cp) = white_gray_list_head.gc_next_cp;
+#else /* !ENABLED (JERRY_GC_LAZY_SWEEP) */
+  /* Sweep objects that are currently unmarked. */
+  obj_iter_cp = white_gray_list_head.gc_next_cp;
 
-        black_end_p->gc_next_cp = obj_iter_cp;
-        black_end_p = obj_iter_p;
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+
+    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
 
+    ecma_gc_free_object (obj_iter_p);
+    obj_iter_cp = obj_next_cp;
+  }
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
+
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+  /* Free RegExp bytecodes stored in cache */
+  re_cache_gc ();
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+
+  jmem_telemetry_gc_cycle (objects_before - unmarked_objects, unmarked_objects);
+
+#if ENABLED (JERRY_GC_ADAPTIVE_LIMIT)
+  ecma_gc_policy_update (start_time, allocated_before, objects_before - unmarked_objects, unmarked_objects);
+#endif /* ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
+
+  jmem_telemetry_gc_pause (jerry_port_get_current_time () - start_time);
+} /* ecma_gc_run */
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+/**
+ * Run a minor garbage collection: only the young objects are collected, and the surviving ones
+ * are promoted to the old generation.
+ *
+ * Note:
+ *      the old objects are not visited, except the members of the remembered set, so the cost
+ *      of the collection does not depend on the size of the old generation
+ */
+static void
+ecma_gc_run_minor (void)
+{
 #if (JERRY_GC_MARK_LIMIT != 0)
-        if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
-        {
-          /* Set the reference count of non-marked gray object to 0 */
-          obj_iter_p->type_flags_refs = (uint16_t) (obj_iter_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
-          ecma_gc_mark (obj_iter_p);
-#if defined(JERRY_HEAPDUMP)
-        if (GetHeapdumpTracing()) {
-          DumpInfoObject(obj_iter_p, HEAPDUMP_OBJECT_SIMPLE);
-        }
-#endif
-          marked_anything_during_current_iteration = true;
-        }
-#else /* (JERRY_GC_MARK_LIMIT == 0) */
-        marked_anything_during_current_iteration = true;
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_stack_top) == 0);
 #endif /* (JERRY_GC_MARK_LIMIT != 0) */
+  JERRY_ASSERT (!(JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_MARK_OVERFLOW));
+#if ENABLED (JERRY_GC_INCREMENTAL)
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_incremental_state) == ECMA_GC_INCREMENTAL_IDLE);
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+  ecma_gc_finish_lazy_sweep ();
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
+
+  double start_time = jerry_port_get_current_time ();
+
+#if ENABLED (JERRY_GC_ADAPTIVE_LIMIT)
+  const size_t allocated_before = JERRY_CONTEXT (jmem_heap_allocated_size);
+#endif /* ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
+  const size_t promoted_before = JERRY_CONTEXT (ecma_gc_promoted_objects);
+  size_t unmarked_objects = 0;
+
+  const jmem_cpointer_t old_objects_cp = JERRY_CONTEXT (ecma_gc_old_objects_cp);
+
+  ecma_object_t black_list_head;
+  black_list_head.gc_next_cp = JMEM_CP_NULL;
+  ecma_object_t *black_end_p = &black_list_head;
+
+  ecma_object_t white_gray_list_head;
+  white_gray_list_head.gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  ecma_object_t *obj_prev_p = &white_gray_list_head;
+  jmem_cpointer_t obj_iter_cp = obj_prev_p->gc_next_cp;
+  ecma_object_t *obj_iter_p;
+
+  /* Move the young root objects to the black list. The young objects precede the old ones. */
+  while (obj_iter_cp != old_objects_cp)
+  {
+    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+
+    JERRY_ASSERT (ecma_gc_bitmap_get (JERRY_CONTEXT (ecma_gc_young_bitmap_p), obj_iter_p));
+
+    if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+    {
+      obj_prev_p->gc_next_cp = obj_next_cp;
+
+      black_end_p->gc_next_cp = obj_iter_cp;
+      black_end_p = obj_iter_p;
+    }
+    else
+    {
+      obj_iter_p->type_flags_refs |= ECMA_OBJECT_NON_VISITED;
+      obj_prev_p = obj_iter_p;
+    }
+
+    obj_iter_cp = obj_next_cp;
+  }
+
+  obj_prev_p->gc_next_cp = JMEM_CP_NULL;
+  black_end_p->gc_next_cp = JMEM_CP_NULL;
+
+  /* Mark young root objects. */
+  obj_iter_cp = black_list_head.gc_next_cp;
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    ecma_gc_mark (obj_iter_p);
+    ecma_gc_mark_worklist ();
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+  }
+
+  /* Mark the young objects referenced by the remembered set. Old objects are never white,
+   * so marking only proceeds into the young generation. */
+  uint32_t *remembered_p = JERRY_CONTEXT (ecma_gc_remembered_bitmap_p);
+  const uint32_t bitmap_words = ECMA_GC_BITMAP_WORDS;
+
+  for (uint32_t i = 0; i < bitmap_words; i++)
+  {
+    uint32_t bits = remembered_p[i];
+
+    for (uint32_t bit = 0; bits != 0; bit++, bits >>= 1)
+    {
+      if (!(bits & 0x1))
+      {
+        continue;
       }
-      else
+
+      size_t offset = (((size_t) i << 5) + bit) << JMEM_ALIGNMENT_LOG;
+      ecma_object_t *object_p = (ecma_object_t *) (JERRY_HEAP_CONTEXT (area) + offset);
+
+      ecma_gc_mark (object_p);
+      ecma_gc_mark_worklist ();
+
+      if (object_p->type_flags_refs < ECMA_OBJECT_REF_ONE)
       {
-        obj_prev_p = obj_iter_p;
+        /* Every young object is promoted, so the old object does not refer to young objects anymore.
+         * Referenced objects are kept, since they can be modified without a write barrier. */
+        remembered_p[i] &= ~((uint32_t) 1 << bit);
       }
+    }
+  }
+
+  ecma_gc_mark_overflowed_objects (white_gray_list_head.gc_next_cp);
 
-      obj_iter_cp = obj_next_cp;
+  /* Move the visited objects to the list of marked objects. */
+  obj_prev_p = &white_gray_list_head;
+  obj_iter_cp = obj_prev_p->gc_next_cp;
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+
+    if (ecma_gc_is_object_visited (obj_iter_p))
+    {
+      JERRY_ASSERT (obj_iter_p->type_flags_refs < ECMA_OBJECT_REF_ONE);
+
+      obj_prev_p->gc_next_cp = obj_next_cp;
+
+      black_end_p->gc_next_cp = obj_iter_cp;
+      black_end_p = obj_iter_p;
     }
+    else
+    {
+      obj_prev_p = obj_iter_p;
+      unmarked_objects++;
+    }
+
+    obj_iter_cp = obj_next_cp;
   }
-  while (marked_anything_during_current_iteration);
 
+  /* Promote the surviving objects to the old generation. */
   black_end_p->gc_next_cp = JMEM_CP_NULL;
+  obj_iter_cp = black_list_head.gc_next_cp;
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    ecma_gc_bitmap_clear (JERRY_CONTEXT (ecma_gc_young_bitmap_p), obj_iter_p);
+
+    if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+    {
+      ecma_gc_bitmap_set (remembered_p, obj_iter_p);
+    }
+
+    JERRY_CONTEXT (ecma_gc_promoted_objects)++;
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+  }
+
+  black_end_p->gc_next_cp = old_objects_cp;
   JERRY_CONTEXT (ecma_gc_objects_cp) = black_list_head.gc_next_cp;
+  JERRY_CONTEXT (ecma_gc_old_objects_cp) = JERRY_CONTEXT (ecma_gc_objects_cp);
 
-  /* Sweep objects that are currently unmarked. */
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+  JERRY_CONTEXT (ecma_gc_lazy_sweep_cp) = white_gray_list_head.gc_next_cp;
+#else /* !ENABLED (JERRY_GC_LAZY_SWEEP) */
+  /* Sweep the young objects that are currently unmarked. */
   obj_iter_cp = white_gray_list_head.gc_next_cp;
 
   while (obj_iter_cp != JMEM_CP_NULL)
@@ -1496,12 +2423,212 @@ ecma_gc_run (void)
     ecma_gc_free_object (obj_iter_p);
     obj_iter_cp = obj_next_cp;
   }
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
 
-#if ENABLED (JERRY_BUILTIN_REGEXP)
-  /* Free RegExp bytecodes stored in cache */
-  re_cache_gc ();
-#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
-} /* ecma_gc_run */
+  /* Every surviving young object is promoted. */
+  const size_t marked_objects = JERRY_CONTEXT (ecma_gc_promoted_objects) - promoted_before;
+  jmem_telemetry_gc_cycle (marked_objects, unmarked_objects);
+
+#if ENABLED (JERRY_GC_ADAPTIVE_LIMIT)
+  ecma_gc_policy_update (start_time, allocated_before, marked_objects, unmarked_objects);
+#endif /* ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
+
+  jmem_telemetry_gc_pause (jerry_port_get_current_time () - start_time);
+} /* ecma_gc_run_minor */
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
+#if ENABLED (JERRY_GC_INCREMENTAL)
+/**
+ * Perform incremental garbage collection work within the given time budget.
+ *
+ * Note:
+ *      a new collection cycle is started when no cycle is in progress
+ *
+ * @return true - if the collection cycle is not finished yet
+ *         false - otherwise
+ */
+bool
+ecma_gc_step (uint32_t budget_us) /**< time budget in microseconds */
+{
+  if (!g_isGCEnabled)
+  {
+    return false;
+  }
+
+  double start_time = jerry_port_get_current_time ();
+  double deadline = start_time + (double) budget_us / 1000.0;
+
+  if (JERRY_CONTEXT (ecma_gc_incremental_state) == ECMA_GC_INCREMENTAL_IDLE
+      && !ecma_gc_incremental_start ())
+  {
+    /* There is not enough memory for an incremental cycle. */
+    ecma_gc_run ();
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+    ecma_gc_finish_lazy_sweep ();
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
+    return false;
+  }
+
+  bool in_progress = ecma_gc_incremental_advance (&deadline);
+
+  jmem_telemetry_gc_pause (jerry_port_get_current_time () - start_time);
+
+  return in_progress;
+} /* ecma_gc_step */
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
+#if ENABLED (JERRY_GC_COMPACTION)
+/**
+ * Move the property pairs, the property slots and the fast array buffers of the live objects
+ * towards the beginning of the heap, so the free regions are merged into larger ones.
+ *
+ * Note:
+ *      objects and strings are never moved, because the values held by the application refer to them,
+ *      the shapes are not moved either, since many objects refer to them,
+ *      the property hashmaps must be freed before
+ */
+static void
+ecma_gc_compact (void)
+{
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_heap_compact (false);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+#if ENABLED (JERRY_LCACHE)
+  /* The lcache refers to the properties by their address. */
+  ecma_lcache_invalidate_all ();
+#endif /* ENABLED (JERRY_LCACHE) */
+
+  jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+
+    if (ecma_is_lexical_environment (obj_iter_p))
+    {
+      if (ecma_get_lex_env_type (obj_iter_p) != ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+      {
+        continue;
+      }
+    }
+    else if (ecma_op_object_is_fast_array (obj_iter_p))
+    {
+      if (obj_iter_p->u1.property_list_cp != JMEM_CP_NULL)
+      {
+        ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) obj_iter_p;
+        const uint32_t aligned_length = ECMA_FAST_ARRAY_ALIGN_LENGTH (ext_object_p->u.array.length);
+        ecma_value_t *values_p = ECMA_GET_NON_NULL_POINTER (ecma_value_t, obj_iter_p->u1.property_list_cp);
+
+        values_p = (ecma_value_t *) jmem_heap_relocate_block (values_p, aligned_length * sizeof (ecma_value_t));
+        ECMA_SET_NON_NULL_POINTER (obj_iter_p->u1.property_list_cp, values_p);
+      }
+      continue;
+    }
+
+    jmem_cpointer_t *prop_iter_cp_p = &obj_iter_p->u1.property_list_cp;
+
+#if ENABLED (JERRY_OBJECT_SHAPES)
+    if (*prop_iter_cp_p != JMEM_CP_NULL)
+    {
+      ecma_property_header_t *slots_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, *prop_iter_cp_p);
+
+      if (slots_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+      {
+        /* The shapes are shared, only the property slots are moved. */
+        ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->next_property_cp);
+        size_t size = ECMA_SHAPE_GET_SLOTS_SIZE (shape_p->property_count);
+
+        slots_p = (ecma_property_header_t *) jmem_heap_relocate_block (slots_p, size);
+        ECMA_SET_NON_NULL_POINTER (*prop_iter_cp_p, slots_p);
+        continue;
+      }
+    }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+    while (*prop_iter_cp_p != JMEM_CP_NULL)
+    {
+      ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, *prop_iter_cp_p);
+      JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+      prop_iter_p = (ecma_property_header_t *) jmem_heap_relocate_block (prop_iter_p, sizeof (ecma_property_pair_t));
+      ECMA_SET_NON_NULL_POINTER (*prop_iter_cp_p, prop_iter_p);
+
+      prop_iter_cp_p = &prop_iter_p->next_property_cp;
+    }
+  }
+
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_heap_compact (true);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+} /* ecma_gc_compact */
+#endif /* ENABLED (JERRY_GC_COMPACTION) */
+
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+/**
+ * Free the given number of objects left over by the last garbage collection.
+ *
+ * @return true - if there are unswept objects left
+ *         false - otherwise
+ */
+bool
+ecma_gc_lazy_sweep (uint32_t count) /**< maximum number of objects to free */
+{
+  while (count > 0 && JERRY_CONTEXT (ecma_gc_lazy_sweep_cp) != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_lazy_sweep_cp));
+
+    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_p));
+
+    /* The object is unlinked first, because freeing it may allocate memory, which continues the sweep. */
+    JERRY_CONTEXT (ecma_gc_lazy_sweep_cp) = obj_p->gc_next_cp;
+    ecma_gc_free_object (obj_p);
+    count--;
+  }
+
+  return JERRY_CONTEXT (ecma_gc_lazy_sweep_cp) != JMEM_CP_NULL;
+} /* ecma_gc_lazy_sweep */
+
+/**
+ * Free all objects left over by the last garbage collection.
+ */
+void
+ecma_gc_finish_lazy_sweep (void)
+{
+  ecma_gc_lazy_sweep (UINT32_MAX);
+} /* ecma_gc_finish_lazy_sweep */
+
+/**
+ * Free the objects left over by the last garbage collection within the given time budget.
+ *
+ * @return true - if there are unswept objects left
+ *         false - otherwise
+ */
+bool
+ecma_gc_sweep_step (uint32_t budget_us) /**< time budget in microseconds */
+{
+  if (JERRY_CONTEXT (ecma_gc_lazy_sweep_cp) == JMEM_CP_NULL)
+  {
+    return false;
+  }
+
+  double start_time = jerry_port_get_current_time ();
+  double deadline = start_time + (double) budget_us / 1000.0;
+  bool in_progress;
+
+  /* At least one batch is freed, so a zero budget still makes progress. */
+  do
+  {
+    in_progress = ecma_gc_lazy_sweep (ECMA_GC_LAZY_SWEEP_WORK_UNIT);
+  }
+  while (in_progress && jerry_port_get_current_time () < deadline);
+
+  jmem_telemetry_gc_pause (jerry_port_get_current_time () - start_time);
+
+  return in_progress;
+} /* ecma_gc_sweep_step */
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
 
 /**
  * Try to free some memory (depending on memory pressure).
@@ -1531,16 +2658,54 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
     }
     JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_HIGH_PRESSURE_GC;
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
+
+#if ENABLED (JERRY_GC_INCREMENTAL)
+    if (JERRY_CONTEXT (ecma_gc_incremental_state) != ECMA_GC_INCREMENTAL_IDLE
+        && g_isGCEnabled)
+    {
+      /* The pending incremental cycle is completed instead of starting a new collection. */
+      ecma_gc_incremental_advance (NULL);
+      return;
+    }
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
+    size_t new_objects_fraction = CONFIG_ECMA_GC_NEW_OBJECTS_FRACTION;
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+    if (JERRY_CONTEXT (ecma_gc_objects_cp) != JERRY_CONTEXT (ecma_gc_old_objects_cp)
+        && g_isGCEnabled)
+    {
+      ecma_gc_run_minor ();
+
+      /* The old generation is only collected when it grew considerably since the last full collection. */
+      if (JERRY_CONTEXT (ecma_gc_promoted_objects) * new_objects_fraction > JERRY_CONTEXT (ecma_gc_objects_number))
+      {
+        ecma_gc_run ();
+      }
+
+      return;
+    }
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
+#if ENABLED (JERRY_GC_ADAPTIVE_LIMIT)
+    /* The limit was computed from the survival ratio of the last collection, so it is honored
+     * whenever a new object may have become garbage since then. */
+    JERRY_UNUSED (new_objects_fraction);
+
+    if (JERRY_CONTEXT (ecma_gc_new_objects) > 0)
+    {
+      ecma_gc_run ();
+    }
+#else /* !ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
     /*
      * If there is enough newly allocated objects since last GC, probably it is worthwhile to start GC now.
      * Otherwise, probability to free sufficient space is considered to be low.
      */
-    size_t new_objects_fraction = CONFIG_ECMA_GC_NEW_OBJECTS_FRACTION;
-
     if (JERRY_CONTEXT (ecma_gc_new_objects) * new_objects_fraction > JERRY_CONTEXT (ecma_gc_objects_number))
     {
       ecma_gc_run ();
     }
+#endif /* ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
 
     return;
   }
@@ -1561,6 +2726,10 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
 
     ecma_gc_run ();
 
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+    ecma_gc_finish_lazy_sweep ();
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
+
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
     /* Free hashmaps of remaining objects. */
     jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
@@ -1597,7 +2766,25 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
     }
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
+#if ENABLED (JERRY_STRING_INDEX)
+    ecma_string_index_cache_free ();
+#endif /* ENABLED (JERRY_STRING_INDEX) */
+
     jmem_pools_collect_empty ();
+#if ENABLED (JERRY_MEM_SIZE_CLASSES)
+    jmem_heap_collect_size_classes ();
+#endif /* ENABLED (JERRY_MEM_SIZE_CLASSES) */
+#if ENABLED (JERRY_MEM_SLAB_ALLOCATOR)
+    jmem_heap_collect_slabs ();
+#endif /* ENABLED (JERRY_MEM_SLAB_ALLOCATOR) */
+#if ENABLED (JERRY_GC_COMPACTION)
+    /* Only jerry_gc sets the flag: a failing allocation may have callers which
+     * hold direct pointers to the property pairs and array buffers. */
+    if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_COMPACT)
+    {
+      ecma_gc_compact ();
+    }
+#endif /* ENABLED (JERRY_GC_COMPACTION) */
     return;
   }
   else if (JERRY_UNLIKELY (pressure == JMEM_PRESSURE_FULL))
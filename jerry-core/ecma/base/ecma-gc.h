@@ -17,6 +17,7 @@
 #define ECMA_GC_H
 
 #include "ecma-globals.h"
+#include "jcontext.h"
 #include "jmem.h"
 
 /** \addtogroup ecma ECMA
@@ -26,6 +27,83 @@
  * @{
  */
 
+#if ENABLED (JERRY_GC_INCREMENTAL)
+/**
+ * Phases of the incremental garbage collector.
+ */
+typedef enum
+{
+  ECMA_GC_INCREMENTAL_IDLE, /**< no incremental collection cycle is in progress */
+  ECMA_GC_INCREMENTAL_MARK, /**< live objects are being marked */
+  ECMA_GC_INCREMENTAL_SWEEP, /**< unmarked objects are being freed */
+} ecma_gc_incremental_state_t;
+
+/**
+ * Number of objects processed by the incremental collector between two checks of the time budget.
+ */
+#define ECMA_GC_INCREMENTAL_WORK_UNIT 64
+
+/**
+ * Write barrier of the incremental collector: an unmarked object cannot hide behind an already marked one.
+ */
+#define ECMA_GC_INCREMENTAL_WRITE_BARRIER(value) \
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (ecma_gc_incremental_state) == ECMA_GC_INCREMENTAL_MARK)) \
+  { \
+    ecma_gc_write_barrier (value); \
+  }
+
+void ecma_gc_write_barrier (ecma_value_t value);
+void ecma_gc_finish_incremental_sweep (void);
+bool ecma_gc_step (uint32_t budget_us);
+#else /* !ENABLED (JERRY_GC_INCREMENTAL) */
+#define ECMA_GC_INCREMENTAL_WRITE_BARRIER(value)
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+/**
+ * Write barrier of the generational collector: old objects which refer to young objects
+ * are recorded in the remembered set.
+ */
+#define ECMA_GC_GENERATIONAL_WRITE_BARRIER(object_p, value) \
+  if (ecma_is_value_object (value)) \
+  { \
+    ecma_gc_generational_write_barrier ((object_p), ecma_get_object_from_value (value)); \
+  }
+
+void ecma_gc_generational_write_barrier (ecma_object_t *object_p, ecma_object_t *value_p);
+void ecma_gc_remember_object (ecma_object_t *object_p);
+void ecma_gc_generational_init (void);
+void ecma_gc_generational_finalize (void);
+#else /* !ENABLED (JERRY_GC_GENERATIONAL) */
+#define ECMA_GC_GENERATIONAL_WRITE_BARRIER(object_p, value)
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+/**
+ * Number of unreachable objects freed by each heap allocation.
+ */
+#define ECMA_GC_LAZY_SWEEP_ALLOC_COUNT 4
+
+/**
+ * Number of unreachable objects freed by a sweep step between two checks of the time budget.
+ */
+#define ECMA_GC_LAZY_SWEEP_WORK_UNIT 16
+
+bool ecma_gc_lazy_sweep (uint32_t count);
+void ecma_gc_finish_lazy_sweep (void);
+bool ecma_gc_sweep_step (uint32_t budget_us);
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
+
+/**
+ * Write barrier: must be used when a value is stored into an existing object without taking a reference.
+ */
+#define ECMA_GC_WRITE_BARRIER(object_p, value) \
+  do \
+  { \
+    ECMA_GC_INCREMENTAL_WRITE_BARRIER (value) \
+    ECMA_GC_GENERATIONAL_WRITE_BARRIER (object_p, value) \
+  } while (0)
+
 void ecma_init_gc_info (ecma_object_t *object_p);
 void ecma_ref_object (ecma_object_t *object_p);
 void ecma_deref_object (ecma_object_t *object_p);
@@ -72,6 +72,16 @@ typedef enum
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
   ECMA_STATUS_EXCEPTION         = (1u << 3), /**< last exception is a normal exception */
   ECMA_STATUS_ABORT             = (1u << 4), /**< last exception is an abort */
+  ECMA_STATUS_GC_MARK_OVERFLOW  = (1u << 5), /**< gray objects are left outside of the GC mark worklist */
+#if ENABLED (JERRY_GC_COMPACTION)
+  ECMA_STATUS_GC_COMPACT        = (1u << 6), /**< heap blocks can be moved by a high pressure gc */
+#endif /* ENABLED (JERRY_GC_COMPACTION) */
+#if ENABLED (JERRY_VM_SUPERINSTRUCTIONS)
+  ECMA_STATUS_HAS_SUPERINSTRUCTIONS = (1u << 7), /**< the parser emitted compare and branch superinstructions */
+#endif /* ENABLED (JERRY_VM_SUPERINSTRUCTIONS) */
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+  ECMA_STATUS_HAS_THREE_ADDRESS_OPCODES = (1u << 8), /**< the parser emitted three-address binary opcodes */
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
 } ecma_status_flag_t;
 
 /**
@@ -85,6 +95,9 @@ typedef enum
   ECMA_TYPE_OBJECT = 3, /**< pointer to description of an object */
   ECMA_TYPE_SYMBOL = 4, /**< pointer to description of a symbol */
   ECMA_TYPE_DIRECT_STRING = 5, /**< directly encoded string values */
+#if ENABLED (JERRY_DIRECT_FLOAT)
+  ECMA_TYPE_DIRECT_FLOAT = 6, /**< directly encoded single precision floating point number */
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
   ECMA_TYPE_ERROR = 7, /**< pointer to description of an error reference (only supported by C API) */
   ECMA_TYPE_SNAPSHOT_OFFSET = ECMA_TYPE_ERROR, /**< offset to a snapshot number/string */
   ECMA_TYPE___MAX = ECMA_TYPE_ERROR /** highest value for ecma types */
@@ -259,15 +272,6 @@ enum
 #define ECMA_IS_INTEGER_NUMBER(num) \
   (ECMA_INTEGER_NUMBER_MIN <= (num) && (num) <= ECMA_INTEGER_NUMBER_MAX)
 
-/**
- * Maximum integer number, which if squared, still fits in ecma_integer_value_t
- */
-#if !ENABLED (JERRY_NUMBER_TYPE_FLOAT64)
-#define ECMA_INTEGER_MULTIPLY_MAX 0xb50
-#else /* ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
-#define ECMA_INTEGER_MULTIPLY_MAX 0x2d41
-#endif /* !ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
-
 /**
  * Checks whether the error flag is set.
  */
@@ -445,6 +449,7 @@ typedef enum
    * ECMA_PROPERTY_IS_PROPERTY_PAIR must be updated as well. */
   ECMA_SPECIAL_PROPERTY_HASHMAP, /**< hashmap property */
   ECMA_SPECIAL_PROPERTY_DELETED, /**< deleted property */
+  ECMA_SPECIAL_PROPERTY_SHAPE, /**< property slots of an object with a shape */
 
   ECMA_SPECIAL_PROPERTY__COUNT /**< Number of special property types */
 } ecma_special_property_id_t;
@@ -465,6 +470,11 @@ typedef enum
  */
 #define ECMA_PROPERTY_TYPE_HASHMAP ECMA_SPECIAL_PROPERTY_VALUE (ECMA_SPECIAL_PROPERTY_HASHMAP)
 
+/**
+ * Type of the property slots of an object with a shape.
+ */
+#define ECMA_PROPERTY_TYPE_SHAPE ECMA_SPECIAL_PROPERTY_VALUE (ECMA_SPECIAL_PROPERTY_SHAPE)
+
 /**
  * Type of property not found.
  */
@@ -567,7 +577,8 @@ typedef struct
  * Returns true if the property pointer is a property pair.
  */
 #define ECMA_PROPERTY_IS_PROPERTY_PAIR(property_header_p) \
-  ((property_header_p)->types[0] != ECMA_PROPERTY_TYPE_HASHMAP)
+  ((property_header_p)->types[0] != ECMA_PROPERTY_TYPE_HASHMAP \
+   && (property_header_p)->types[0] != ECMA_PROPERTY_TYPE_SHAPE)
 
 /**
  * Returns true if the property is named property.
@@ -1221,6 +1232,18 @@ typedef union
 #define ECMA_NUMBER_FRACTION_WIDTH   (52)
 #endif /* !ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
 
+#if ENABLED (JERRY_DIRECT_FLOAT)
+/**
+ * It makes possible to read/write the float of a direct float value as uint32_t
+ * without strict aliasing rule violation.
+ */
+typedef union
+{
+  float as_float;
+  uint32_t as_uint32_t;
+} ecma_direct_float_accessor_t;
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
+
 /**
  * Value '0' of ecma_number_t
  */
@@ -1501,7 +1524,10 @@ typedef enum
 
   ECMA_STRING_CONTAINER_SYMBOL, /**< the ecma-string is a symbol */
 
-  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_SYMBOL /**< maximum value */
+  ECMA_STRING_CONTAINER_ROPE, /**< the ecma-string is the concatenation of two ecma-strings
+                               *   (only used when JERRY_ROPE_STRINGS is enabled) */
+
+  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_ROPE /**< maximum value */
 } ecma_string_container_t;
 
 /**
@@ -1596,6 +1622,67 @@ typedef struct
   lit_utf8_size_t length; /**< length of this long utf-8 string in bytes */
 } ecma_long_utf8_string_t;
 
+#if ENABLED (JERRY_ROPE_STRINGS)
+
+/**
+ * ECMA rope string-value descriptor
+ *
+ * Note:
+ *   the hash of the header is always valid, it is computed when the rope is created
+ */
+typedef struct
+{
+  ecma_string_t header; /**< string header */
+  lit_utf8_size_t size; /**< size of the concatenated string in bytes */
+  lit_utf8_size_t length; /**< length of the concatenated string */
+  ecma_value_t left; /**< left part of the string, or the flattened string */
+  ecma_value_t right; /**< right part of the string (never a rope), or ECMA_VALUE_EMPTY after flattening */
+} ecma_rope_string_t;
+
+/**
+ * Minimum size of the left part of a rope. Shorter strings are always copied.
+ *
+ * Note:
+ *   ropes are longer than any magic string or uint32 number
+ */
+#define ECMA_ROPE_STRING_MIN_SIZE 256
+
+/**
+ * Maximum size of the right part of a rope which is created by merging appended parts.
+ */
+#define ECMA_ROPE_STRING_CHUNK_SIZE 256
+
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
+#if ENABLED (JERRY_STRING_INDEX)
+
+/**
+ * Index table of a non-ASCII string, which maps code unit indices to byte offsets
+ */
+typedef struct
+{
+  const ecma_string_t *string_p; /**< indexed string (NULL if the entry is unused) */
+  lit_utf8_size_t *offsets_p; /**< byte offset of every ECMA_STRING_INDEX_STEP-th code unit */
+  ecma_length_t count; /**< number of items in offsets_p */
+} ecma_string_index_t;
+
+/**
+ * Number of code units between the items of a string index table (must be a power of 2).
+ */
+#define ECMA_STRING_INDEX_STEP 32
+
+/**
+ * Minimum length of a string which gets an index table.
+ */
+#define ECMA_STRING_INDEX_MIN_LENGTH 128
+
+/**
+ * Number of string index tables cached by the engine.
+ */
+#define ECMA_STRING_INDEX_CACHE_SIZE 4
+
+#endif /* ENABLED (JERRY_STRING_INDEX) */
+
 /**
  * Get the start position of the string buffer of an ecma ASCII string
  */
@@ -1719,6 +1806,21 @@ typedef struct
   jmem_cpointer_t values[ECMA_LIT_STORAGE_VALUE_COUNT]; /**< list of values */
 } ecma_number_storage_item_t;
 
+#if ENABLED (JERRY_LIT_HASH_TABLE)
+
+/**
+ * Open addressing hash table of literal values
+ */
+typedef struct
+{
+  jmem_cpointer_t *slots_p; /**< slots which hold the values (NULL if the table is not allocated) */
+  uint32_t size; /**< number of slots (a power of 2, or 0 if the table is not allocated) */
+  uint32_t count; /**< number of values in the table */
+  bool is_disabled; /**< the table could not be grown, so the literal storage must be scanned */
+} ecma_lit_hash_table_t;
+
+#endif /* ENABLED (JERRY_LIT_HASH_TABLE) */
+
 #if ENABLED (JERRY_LCACHE)
 /**
  * Container of an LCache entry identifier
@@ -1753,6 +1855,49 @@ typedef struct
 
 #endif /* ENABLED (JERRY_LCACHE) */
 
+#if ENABLED (JERRY_INLINE_CACHE)
+/**
+ * Entry of the inline caches
+ */
+typedef struct
+{
+  jmem_cpointer_t shape_cp; /**< shape of the accessed object, JMEM_CP_NULL for unused entries */
+  jmem_cpointer_t holder_shape_cp; /**< shape of the prototype which has the property,
+                                    *   JMEM_CP_NULL if the property is an own property */
+  jmem_cpointer_t prototype_cp; /**< prototype of the accessed object if holder_shape_cp is not JMEM_CP_NULL */
+  uint8_t name_index; /**< index of the property name in the shape of the holder */
+} ecma_icache_entry_t;
+
+/**
+ * Number of rows in the inline cache table, each instruction is assigned to a row (must be a power of 2)
+ */
+#define ECMA_ICACHE_ROWS_COUNT 128
+
+/**
+ * Number of entries in a row of the inline cache table
+ */
+#define ECMA_ICACHE_ROW_LENGTH 4
+
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
+#if ENABLED (JERRY_GC_PARALLEL_MARK)
+/**
+ * Capacity of the gray object deque of a parallel marking worker (must be a power of 2)
+ */
+#define ECMA_GC_MARK_DEQUE_SIZE 1024
+
+/**
+ * Work-stealing deque of the gray objects of a parallel marking worker: the owner
+ * pushes and pops the objects at the bottom, the other workers steal them from the top.
+ */
+typedef struct
+{
+  uint32_t top; /**< index of the oldest object */
+  uint32_t bottom; /**< index after the newest object */
+  jmem_cpointer_t objects[ECMA_GC_MARK_DEQUE_SIZE]; /**< ring buffer of the objects */
+} ecma_gc_mark_deque_t;
+#endif /* ENABLED (JERRY_GC_PARALLEL_MARK) */
+
 #if ENABLED (JERRY_ES2015_BUILTIN_TYPEDARRAY)
 
 /**
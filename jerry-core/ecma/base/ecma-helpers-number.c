@@ -686,26 +686,33 @@ ecma_number_pow (ecma_number_t x, /**< left operand */
 /**
  * ECMA-integer number multiplication.
  *
+ * The product is computed with int32 arithmetic when it does not overflow,
+ * so the conversion to ecma_number_t is only needed for large products and
+ * negative zero.
+ *
  * @return number - result of multiplication.
  */
 inline ecma_value_t JERRY_ATTR_ALWAYS_INLINE
 ecma_integer_multiply (ecma_integer_value_t left_integer, /**< left operand */
                        ecma_integer_value_t right_integer) /**< right operand */
 {
-#if defined (__GNUC__) || defined (__clang__)
-  /* Check if left_integer is power of 2 */
-  if (JERRY_UNLIKELY ((left_integer & (left_integer - 1)) == 0))
-  {
-    /* Right shift right_integer with log2 (left_integer) */
-    return ecma_make_integer_value (right_integer << (__builtin_ctz ((unsigned int) left_integer)));
-  }
-  else if (JERRY_UNLIKELY ((right_integer & (right_integer - 1)) == 0))
+  int32_t multiply;
+#if (defined (__GNUC__) && __GNUC__ >= 5) || defined (__clang__)
+  bool is_overflow = __builtin_mul_overflow (left_integer, right_integer, &multiply);
+#else /* !((defined (__GNUC__) && __GNUC__ >= 5) || defined (__clang__)) */
+  int64_t wide_multiply = (int64_t) left_integer * (int64_t) right_integer;
+  multiply = (int32_t) wide_multiply;
+  bool is_overflow = (wide_multiply != (int64_t) multiply);
+#endif /* (defined (__GNUC__) && __GNUC__ >= 5) || defined (__clang__) */
+
+  /* A zero product is negative zero if one of the operands is negative. */
+  if (JERRY_LIKELY (!is_overflow)
+      && (multiply != 0 || (left_integer | right_integer) >= 0))
   {
-    /* Right shift left_integer with log2 (right_integer) */
-    return ecma_make_integer_value (left_integer << (__builtin_ctz ((unsigned int) right_integer)));
+    return ecma_make_int32_value (multiply);
   }
-#endif /* defined (__GNUC__) || defined (__clang__) */
-  return ecma_make_integer_value (left_integer * right_integer);
+
+  return ecma_make_number_value ((ecma_number_t) left_integer * (ecma_number_t) right_integer);
 } /* ecma_integer_multiply */
 
 /**
@@ -18,6 +18,7 @@
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "lit-char-helpers.h"
@@ -54,6 +55,24 @@ JERRY_STATIC_ASSERT (ECMA_PROPERTY_NAME_TYPE_SHIFT > ECMA_VALUE_SHIFT,
 JERRY_STATIC_ASSERT (sizeof (ecma_stringbuilder_header_t) <= sizeof (ecma_ascii_string_t),
                      ecma_stringbuilder_header_must_not_be_larger_than_ecma_ascii_string);
 
+#if ENABLED (JERRY_ROPE_STRINGS)
+
+JERRY_STATIC_ASSERT (ECMA_ROPE_STRING_CHUNK_SIZE <= ECMA_ROPE_STRING_MIN_SIZE,
+                     ecma_rope_string_chunks_must_not_be_ropes);
+
+JERRY_STATIC_ASSERT (ECMA_ROPE_STRING_MIN_SIZE > ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32,
+                     ecma_rope_strings_must_not_be_uint32_numbers);
+
+/**
+ * Checks whether the string is a rope.
+ */
+#define ECMA_STRING_IS_ROPE(string_p) \
+  (!ECMA_IS_DIRECT_STRING (string_p) && ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+
+static const ecma_string_t *ecma_rope_string_flatten (const ecma_string_t *string_p);
+
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
 /**
  * Convert a string to an unsigned 32 bit value if possible
  *
@@ -130,6 +149,13 @@ static const lit_utf8_byte_t *
 ecma_string_get_chars_fast (const ecma_string_t *string_p, /**< ecma-string */
                             lit_utf8_size_t *size_p) /**< [out] size of the ecma string */
 {
+#if ENABLED (JERRY_ROPE_STRINGS)
+  if (ECMA_STRING_IS_ROPE (string_p))
+  {
+    string_p = ecma_rope_string_flatten (string_p);
+  }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
   if (ECMA_IS_DIRECT_STRING (string_p))
   {
     if (ECMA_GET_DIRECT_STRING_TYPE (string_p) == ECMA_DIRECT_STRING_MAGIC)
@@ -285,6 +311,447 @@ ecma_new_ecma_string_from_utf8_buffer (lit_utf8_size_t length, /**< length of th
   return (ecma_string_t *) string_desc_p;
 } /* ecma_new_ecma_string_from_utf8_buffer */
 
+#if ENABLED (JERRY_ROPE_STRINGS)
+
+/**
+ * Copy the characters of a rope into a newly allocated string, which replaces the parts of the rope.
+ *
+ * Note:
+ *   the value of the rope does not change, only its representation
+ *
+ * @return pointer to the flattened string (the rope keeps a reference to it)
+ */
+static const ecma_string_t *
+ecma_rope_string_flatten (const ecma_string_t *string_p) /**< rope string */
+{
+  JERRY_ASSERT (ECMA_STRING_IS_ROPE (string_p));
+
+  ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+
+  if (rope_p->right == ECMA_VALUE_EMPTY)
+  {
+    return ecma_get_string_from_value (rope_p->left);
+  }
+
+  lit_utf8_byte_t *data_p;
+  ecma_string_t *flat_p = ecma_new_ecma_string_from_utf8_buffer (rope_p->length, rope_p->size, &data_p);
+  lit_utf8_size_t position = rope_p->size;
+  const ecma_rope_string_t *current_p = rope_p;
+
+  /* The ropes only grow on their left side, so the left parts are walked iteratively. */
+  while (true)
+  {
+    if (current_p->right == ECMA_VALUE_EMPTY)
+    {
+      /* The left part is a rope which has already been flattened. */
+      ecma_string_t *left_p = ecma_get_string_from_value (current_p->left);
+      lit_utf8_size_t size = ecma_string_copy_to_cesu8_buffer (left_p, data_p, position);
+      JERRY_ASSERT (size == position);
+      JERRY_UNUSED (size);
+      break;
+    }
+
+    ecma_string_t *right_p = ecma_get_string_from_value (current_p->right);
+    JERRY_ASSERT (!ECMA_STRING_IS_ROPE (right_p));
+
+    lit_utf8_size_t right_size = ecma_string_get_size (right_p);
+    JERRY_ASSERT (right_size <= position);
+
+    position -= right_size;
+    lit_utf8_size_t size = ecma_string_copy_to_cesu8_buffer (right_p, data_p + position, right_size);
+    JERRY_ASSERT (size == right_size);
+    JERRY_UNUSED (size);
+
+    ecma_string_t *left_p = ecma_get_string_from_value (current_p->left);
+
+    if (ECMA_STRING_IS_ROPE (left_p))
+    {
+      current_p = (const ecma_rope_string_t *) left_p;
+      continue;
+    }
+
+    size = ecma_string_copy_to_cesu8_buffer (left_p, data_p, position);
+    JERRY_ASSERT (size == position);
+    break;
+  }
+
+#ifndef JERRY_NDEBUG
+  JERRY_ASSERT (rope_p->header.u.hash == lit_utf8_string_calc_hash (data_p, rope_p->size));
+  JERRY_ASSERT (lit_is_utf8_string_magic (data_p, rope_p->size) == LIT_MAGIC_STRING__COUNT
+                && lit_get_magic_string_ex_count () == 0);
+#endif /* !JERRY_NDEBUG */
+
+  flat_p->u.hash = rope_p->header.u.hash;
+
+  ecma_value_t left = rope_p->left;
+  ecma_value_t right = rope_p->right;
+
+  rope_p->left = ecma_make_string_value (flat_p);
+  rope_p->right = ECMA_VALUE_EMPTY;
+
+  ecma_deref_ecma_string (ecma_get_string_from_value (right));
+  ecma_deref_ecma_string (ecma_get_string_from_value (left));
+
+  return flat_p;
+} /* ecma_rope_string_flatten */
+
+/**
+ * Deallocate a rope and the ropes on its left side which are not referenced anymore
+ */
+static void
+ecma_rope_string_destroy (ecma_string_t *string_p) /**< rope string */
+{
+  while (true)
+  {
+    JERRY_ASSERT (ECMA_STRING_IS_ROPE (string_p));
+
+    ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+    ecma_value_t left = rope_p->left;
+    ecma_value_t right = rope_p->right;
+
+    ecma_dealloc_string_buffer (string_p, sizeof (ecma_rope_string_t));
+
+    if (right != ECMA_VALUE_EMPTY)
+    {
+      ecma_deref_ecma_string (ecma_get_string_from_value (right));
+    }
+
+    string_p = ecma_get_string_from_value (left);
+
+    /* Long chains of ropes are freed iteratively instead of recursively. */
+    if (!ECMA_STRING_IS_ROPE (string_p))
+    {
+      ecma_deref_ecma_string (string_p);
+      return;
+    }
+
+    JERRY_ASSERT (string_p->refs_and_container >= ECMA_STRING_REF_ONE);
+    string_p->refs_and_container -= ECMA_STRING_REF_ONE;
+
+    if (string_p->refs_and_container >= ECMA_STRING_REF_ONE)
+    {
+      return;
+    }
+  }
+} /* ecma_rope_string_destroy */
+
+/**
+ * Append a cesu8 string after an ecma-string by creating a rope.
+ *
+ * Note:
+ *   The string1_p argument is freed when a rope is created.
+ *
+ * @return the rope - if the string is long enough to be represented as a rope
+ *         NULL - otherwise
+ */
+static ecma_string_t *
+ecma_rope_string_append_chars (ecma_string_t *string1_p, /**< base ecma-string */
+                               const lit_utf8_byte_t *cesu8_string2_p, /**< characters to be appended */
+                               lit_utf8_size_t cesu8_string2_size, /**< byte size of cesu8_string2_p */
+                               lit_utf8_size_t cesu8_string2_length) /**< character length of cesu8_string2_p */
+{
+  if (ECMA_IS_DIRECT_STRING (string1_p)
+      || lit_get_magic_string_ex_count () > 0)
+  {
+    return NULL;
+  }
+
+  lit_utf8_size_t string1_size;
+  ecma_length_t string1_length;
+  ecma_value_t left = ecma_make_string_value (string1_p);
+  ecma_value_t right = ECMA_VALUE_EMPTY;
+
+  if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    ecma_rope_string_t *rope1_p = (ecma_rope_string_t *) string1_p;
+    string1_size = rope1_p->size;
+    string1_length = rope1_p->length;
+
+    if (rope1_p->right != ECMA_VALUE_EMPTY)
+    {
+      ecma_string_t *right1_p = ecma_get_string_from_value (rope1_p->right);
+
+      if (ecma_string_get_size (right1_p) + cesu8_string2_size <= ECMA_ROPE_STRING_CHUNK_SIZE)
+      {
+        /* Short parts are merged, so the number of ropes is proportional to the size of the string. */
+        ecma_ref_ecma_string (right1_p);
+        right1_p = ecma_append_chars_to_string (right1_p, cesu8_string2_p, cesu8_string2_size, cesu8_string2_length);
+        right = ecma_make_string_value (right1_p);
+
+        left = rope1_p->left;
+        ecma_ref_ecma_string (ecma_get_string_from_value (left));
+      }
+    }
+  }
+  else
+  {
+    switch (ECMA_STRING_GET_CONTAINER (string1_p))
+    {
+      case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+      case ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING:
+      case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
+      {
+        break;
+      }
+      default:
+      {
+        return NULL;
+      }
+    }
+
+    string1_size = ecma_string_get_size (string1_p);
+
+    if (string1_size < ECMA_ROPE_STRING_MIN_SIZE)
+    {
+      return NULL;
+    }
+
+    string1_length = ecma_string_get_length (string1_p);
+  }
+
+  lit_utf8_size_t new_size = string1_size + cesu8_string2_size;
+
+  /* Poor man's carry flag check: it is impossible to allocate this large string. */
+  if (new_size < (string1_size | cesu8_string2_size))
+  {
+    jerry_fatal (ERR_OUT_OF_MEMORY);
+  }
+
+  lit_string_hash_t hash = lit_utf8_string_hash_combine (string1_p->u.hash, cesu8_string2_p, cesu8_string2_size);
+
+  if (right == ECMA_VALUE_EMPTY)
+  {
+    right = ecma_make_string_value (ecma_new_ecma_string_from_utf8 (cesu8_string2_p, cesu8_string2_size));
+  }
+  else
+  {
+    ecma_deref_ecma_string (string1_p);
+  }
+
+  ecma_rope_string_t *rope_p = (ecma_rope_string_t *) ecma_alloc_string_buffer (sizeof (ecma_rope_string_t));
+  rope_p->header.refs_and_container = ECMA_STRING_CONTAINER_ROPE | ECMA_STRING_REF_ONE;
+  rope_p->header.u.hash = hash;
+  rope_p->size = new_size;
+  rope_p->length = string1_length + cesu8_string2_length;
+  rope_p->left = left;
+  rope_p->right = right;
+
+  return (ecma_string_t *) rope_p;
+} /* ecma_rope_string_append_chars */
+
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
+#if ENABLED (JERRY_STRING_INDEX)
+
+JERRY_STATIC_ASSERT ((ECMA_STRING_INDEX_STEP & (ECMA_STRING_INDEX_STEP - 1)) == 0,
+                     ecma_string_index_step_must_be_a_power_of_2);
+
+JERRY_STATIC_ASSERT (ECMA_STRING_INDEX_CACHE_SIZE <= UINT8_MAX,
+                     ecma_string_index_cache_idx_must_fit_into_uint8);
+
+/**
+ * Checks whether a string with the given size and length may have an index table.
+ */
+#define ECMA_STRING_INDEX_IS_INDEXED(size, length) \
+  ((length) >= ECMA_STRING_INDEX_MIN_LENGTH && (size) != (length))
+
+/**
+ * Free the index table of a string cache entry.
+ */
+static void
+ecma_string_index_free (ecma_string_index_t *index_p) /**< string index cache entry */
+{
+  JERRY_ASSERT (index_p->string_p != NULL);
+
+  jmem_heap_free_block (index_p->offsets_p, index_p->count * sizeof (lit_utf8_size_t));
+  index_p->string_p = NULL;
+} /* ecma_string_index_free */
+
+/**
+ * Free the index table of a string which is destroyed.
+ */
+static void JERRY_ATTR_NOINLINE
+ecma_string_index_drop (const ecma_string_t *string_p) /**< destroyed string */
+{
+  ecma_string_index_t *index_p = JERRY_CONTEXT (ecma_string_index_cache);
+
+  for (uint32_t i = 0; i < ECMA_STRING_INDEX_CACHE_SIZE; i++, index_p++)
+  {
+    if (index_p->string_p == string_p)
+    {
+      ecma_string_index_free (index_p);
+      return;
+    }
+  }
+} /* ecma_string_index_drop */
+
+/**
+ * Free the index tables of all strings.
+ */
+void
+ecma_string_index_cache_free (void)
+{
+  ecma_string_index_t *index_p = JERRY_CONTEXT (ecma_string_index_cache);
+
+  for (uint32_t i = 0; i < ECMA_STRING_INDEX_CACHE_SIZE; i++, index_p++)
+  {
+    if (index_p->string_p != NULL)
+    {
+      ecma_string_index_free (index_p);
+    }
+  }
+
+  JERRY_CONTEXT (ecma_string_index_cache_idx) = 0;
+} /* ecma_string_index_cache_free */
+
+/**
+ * Get the index table of a string, and build it if the string has no table yet.
+ *
+ * @return byte offsets of every ECMA_STRING_INDEX_STEP-th code unit of the string
+ *         NULL - if the string is not indexed or the table cannot be allocated
+ */
+static const lit_utf8_size_t *
+ecma_string_index_get (const ecma_string_t *string_p, /**< ecma-string */
+                       const lit_utf8_byte_t *chars_p, /**< characters of the string */
+                       lit_utf8_size_t size) /**< size of the string */
+{
+#if ENABLED (JERRY_ROPE_STRINGS)
+  if (ECMA_STRING_IS_ROPE (string_p))
+  {
+    /* The characters are stored in the flattened string. */
+    string_p = ecma_rope_string_flatten (string_p);
+  }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
+  if (ECMA_IS_DIRECT_STRING (string_p))
+  {
+    return NULL;
+  }
+
+  ecma_length_t length;
+
+  switch (ECMA_STRING_GET_CONTAINER (string_p))
+  {
+    case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+    {
+      JERRY_ASSERT (ECMA_UTF8_STRING_GET_BUFFER (string_p) == chars_p);
+      length = ((ecma_utf8_string_t *) string_p)->length;
+      break;
+    }
+    case ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING:
+    {
+      JERRY_ASSERT (ECMA_LONG_UTF8_STRING_GET_BUFFER (string_p) == chars_p);
+      length = ((ecma_long_utf8_string_t *) string_p)->length;
+      break;
+    }
+    default:
+    {
+      return NULL;
+    }
+  }
+
+  if (!ECMA_STRING_INDEX_IS_INDEXED (size, length))
+  {
+    return NULL;
+  }
+
+  ecma_string_index_t *cache_p = JERRY_CONTEXT (ecma_string_index_cache);
+
+  for (uint32_t i = 0; i < ECMA_STRING_INDEX_CACHE_SIZE; i++)
+  {
+    if (cache_p[i].string_p == string_p)
+    {
+      return cache_p[i].offsets_p;
+    }
+  }
+
+  /* The offsets of the indices which are multiples of the step, including the length. */
+  ecma_length_t count = (length / ECMA_STRING_INDEX_STEP) + 1;
+  lit_utf8_size_t *offsets_p;
+  offsets_p = (lit_utf8_size_t *) jmem_heap_alloc_block_null_on_error (count * sizeof (lit_utf8_size_t));
+
+  if (offsets_p == NULL)
+  {
+    return NULL;
+  }
+
+  const lit_utf8_byte_t *current_p = chars_p;
+
+  for (ecma_length_t i = 0; i <= length; i++)
+  {
+    if ((i % ECMA_STRING_INDEX_STEP) == 0)
+    {
+      offsets_p[i / ECMA_STRING_INDEX_STEP] = (lit_utf8_size_t) (current_p - chars_p);
+    }
+
+    if (i < length)
+    {
+      current_p += lit_get_unicode_char_size_by_utf8_first_byte (*current_p);
+    }
+  }
+
+  JERRY_ASSERT (current_p == chars_p + size);
+
+  uint8_t cache_idx = JERRY_CONTEXT (ecma_string_index_cache_idx);
+  ecma_string_index_t *index_p = cache_p + cache_idx;
+
+  if (index_p->string_p != NULL)
+  {
+    ecma_string_index_free (index_p);
+  }
+
+  index_p->string_p = string_p;
+  index_p->offsets_p = offsets_p;
+  index_p->count = count;
+
+  JERRY_CONTEXT (ecma_string_index_cache_idx) = (uint8_t) ((cache_idx + 1) % ECMA_STRING_INDEX_CACHE_SIZE);
+  return offsets_p;
+} /* ecma_string_index_get */
+
+#endif /* ENABLED (JERRY_STRING_INDEX) */
+
+/**
+ * Get the byte offset of a code unit in the characters of a string.
+ *
+ * Note:
+ *   chars_p must be the buffer returned by ecma_string_get_chars for the string
+ *
+ * @return byte offset of the code unit
+ */
+lit_utf8_size_t
+ecma_string_index_to_offset (const ecma_string_t *string_p, /**< ecma-string */
+                             const lit_utf8_byte_t *chars_p, /**< characters of the string */
+                             lit_utf8_size_t size, /**< size of the string */
+                             ecma_length_t index) /**< index of a code unit (may be equal to the length) */
+{
+  const lit_utf8_byte_t *current_p = chars_p;
+
+#if ENABLED (JERRY_STRING_INDEX)
+  if (index >= ECMA_STRING_INDEX_STEP)
+  {
+    const lit_utf8_size_t *offsets_p = ecma_string_index_get (string_p, chars_p, size);
+
+    if (offsets_p != NULL)
+    {
+      current_p += offsets_p[index / ECMA_STRING_INDEX_STEP];
+      index %= ECMA_STRING_INDEX_STEP;
+    }
+  }
+#else /* !ENABLED (JERRY_STRING_INDEX) */
+  JERRY_UNUSED (string_p);
+#endif /* ENABLED (JERRY_STRING_INDEX) */
+
+  while (index > 0)
+  {
+    JERRY_ASSERT (current_p < chars_p + size);
+    current_p += lit_get_unicode_char_size_by_utf8_first_byte (*current_p);
+    index--;
+  }
+
+  JERRY_ASSERT (current_p <= chars_p + size);
+  return (lit_utf8_size_t) (current_p - chars_p);
+} /* ecma_string_index_to_offset */
+
 /**
  * Checks whether a string has a special representation, that is, the string is either a magic string,
  * an external magic string, or an uint32 number, and creates an ecma string using the special representation,
@@ -652,6 +1119,18 @@ ecma_append_chars_to_string (ecma_string_t *string1_p, /**< base ecma-string */
     return ecma_new_ecma_string_from_utf8 (cesu8_string2_p, cesu8_string2_size);
   }
 
+#if ENABLED (JERRY_ROPE_STRINGS)
+  ecma_string_t *rope_p = ecma_rope_string_append_chars (string1_p,
+                                                         cesu8_string2_p,
+                                                         cesu8_string2_size,
+                                                         cesu8_string2_length);
+
+  if (rope_p != NULL)
+  {
+    return rope_p;
+  }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
   lit_utf8_size_t cesu8_string1_size;
   lit_utf8_size_t cesu8_string1_length;
   uint8_t flags = ECMA_STRING_FLAG_IS_ASCII;
@@ -870,11 +1349,25 @@ ecma_destroy_ecma_string (ecma_string_t *string_p) /**< ecma-string */
   {
     case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
     {
+#if ENABLED (JERRY_STRING_INDEX)
+      if (ECMA_STRING_INDEX_IS_INDEXED (((ecma_utf8_string_t *) string_p)->size,
+                                        ((ecma_utf8_string_t *) string_p)->length))
+      {
+        ecma_string_index_drop (string_p);
+      }
+#endif /* ENABLED (JERRY_STRING_INDEX) */
       ecma_dealloc_string_buffer (string_p, ((ecma_utf8_string_t *) string_p)->size + sizeof (ecma_utf8_string_t));
       return;
     }
     case ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING:
     {
+#if ENABLED (JERRY_STRING_INDEX)
+      if (ECMA_STRING_INDEX_IS_INDEXED (((ecma_long_utf8_string_t *) string_p)->size,
+                                        ((ecma_long_utf8_string_t *) string_p)->length))
+      {
+        ecma_string_index_drop (string_p);
+      }
+#endif /* ENABLED (JERRY_STRING_INDEX) */
       ecma_dealloc_string_buffer (string_p,
                                   ((ecma_long_utf8_string_t *) string_p)->size + sizeof (ecma_long_utf8_string_t));
       return;
@@ -894,6 +1387,13 @@ ecma_destroy_ecma_string (ecma_string_t *string_p) /**< ecma-string */
       return;
     }
 #endif /* ENABLED (JERRY_ES2015) */
+#if ENABLED (JERRY_ROPE_STRINGS)
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      ecma_rope_string_destroy (string_p);
+      return;
+    }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_UINT32_IN_DESC
@@ -1138,10 +1638,7 @@ ecma_substring_copy_to_cesu8_buffer (const ecma_string_t *string_desc_p, /**< ec
   else
   {
     end_pos -= start_pos;
-    while (start_pos--)
-    {
-      start_p += lit_get_unicode_char_size_by_utf8_first_byte (*start_p);
-    }
+    start_p += ecma_string_index_to_offset (string_desc_p, utf8_str_p, utf8_str_size, start_pos);
 
     const lit_utf8_byte_t *end_p = start_p;
 
@@ -1374,6 +1871,13 @@ ecma_string_get_chars (const ecma_string_t *string_p, /**< ecma-string */
   lit_utf8_size_t size;
   const lit_utf8_byte_t *result_p;
 
+#if ENABLED (JERRY_ROPE_STRINGS)
+  if (ECMA_STRING_IS_ROPE (string_p))
+  {
+    string_p = ecma_rope_string_flatten (string_p);
+  }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
   if (ECMA_IS_DIRECT_STRING (string_p))
   {
     *flags_p |= ECMA_STRING_FLAG_REHASH_NEEDED;
@@ -1586,6 +2090,14 @@ ecma_string_to_property_name (ecma_string_t *prop_name_p, /**< property name */
 
   *name_type_p = ECMA_DIRECT_STRING_PTR << ECMA_PROPERTY_NAME_TYPE_SHIFT;
 
+#if ENABLED (JERRY_ROPE_STRINGS)
+  if (ECMA_STRING_GET_CONTAINER (prop_name_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    /* Property names are never ropes, so they can be compared by their containers. */
+    prop_name_p = (ecma_string_t *) ecma_rope_string_flatten (prop_name_p);
+  }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
   ecma_ref_ecma_string (prop_name_p);
 
   jmem_cpointer_t prop_name_cp;
@@ -1684,6 +2196,35 @@ ecma_string_compare_to_property_name (ecma_property_t property, /**< property na
   return ecma_compare_ecma_non_direct_strings (prop_name_p, string_p);
 } /* ecma_string_compare_to_property_name */
 
+#if ENABLED (JERRY_ROPE_STRINGS)
+
+/**
+ * Compare two non-direct ecma-strings when any of them is a rope
+ *
+ * @return true - if strings are equal;
+ *         false - otherwise
+ */
+static bool JERRY_ATTR_NOINLINE
+ecma_compare_rope_strings (const ecma_string_t *string1_p, /**< ecma-string */
+                           const ecma_string_t *string2_p) /**< ecma-string */
+{
+  JERRY_ASSERT (ECMA_STRING_IS_ROPE (string1_p) || ECMA_STRING_IS_ROPE (string2_p));
+
+  if (ECMA_STRING_IS_ROPE (string1_p))
+  {
+    string1_p = ecma_rope_string_flatten (string1_p);
+  }
+
+  if (ECMA_STRING_IS_ROPE (string2_p))
+  {
+    string2_p = ecma_rope_string_flatten (string2_p);
+  }
+
+  return ecma_compare_ecma_non_direct_strings (string1_p, string2_p);
+} /* ecma_compare_rope_strings */
+
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
 /**
  * Long path part of ecma-string to ecma-string comparison routine
  *
@@ -1699,6 +2240,13 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /**< ecma-st
 {
   JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_GET_CONTAINER (string2_p));
 
+#if ENABLED (JERRY_ROPE_STRINGS)
+  if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    return ecma_compare_rope_strings (string1_p, string2_p);
+  }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
   const lit_utf8_byte_t *utf8_string1_p, *utf8_string2_p;
   lit_utf8_size_t utf8_string1_size, utf8_string2_size;
 
@@ -1768,6 +2316,13 @@ ecma_compare_ecma_strings (const ecma_string_t *string1_p, /**< ecma-string */
 
   if (string1_container != ECMA_STRING_GET_CONTAINER (string2_p))
   {
+#if ENABLED (JERRY_ROPE_STRINGS)
+    if (string1_container == ECMA_STRING_CONTAINER_ROPE
+        || ECMA_STRING_GET_CONTAINER (string2_p) == ECMA_STRING_CONTAINER_ROPE)
+    {
+      return ecma_compare_rope_strings (string1_p, string2_p);
+    }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
     return false;
   }
 
@@ -1900,6 +2455,13 @@ ecma_compare_ecma_non_direct_strings (const ecma_string_t *string1_p, /**< ecma-
 
   if (string1_container != ECMA_STRING_GET_CONTAINER (string2_p))
   {
+#if ENABLED (JERRY_ROPE_STRINGS)
+    if (string1_container == ECMA_STRING_CONTAINER_ROPE
+        || ECMA_STRING_GET_CONTAINER (string2_p) == ECMA_STRING_CONTAINER_ROPE)
+    {
+      return ecma_compare_rope_strings (string1_p, string2_p);
+    }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
     return false;
   }
 
@@ -2092,6 +2654,13 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
                                    lit_get_magic_string_ex_size (id));
   }
 
+#if ENABLED (JERRY_ROPE_STRINGS)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    return ((ecma_rope_string_t *) string_p)->length;
+  }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
   if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING)
   {
     return (ecma_length_t) (((ecma_utf8_string_t *) string_p)->length);
@@ -2117,6 +2686,13 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
 ecma_length_t
 ecma_string_get_utf8_length (const ecma_string_t *string_p) /**< ecma-string */
 {
+#if ENABLED (JERRY_ROPE_STRINGS)
+  if (ECMA_STRING_IS_ROPE (string_p))
+  {
+    string_p = ecma_rope_string_flatten (string_p);
+  }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
   ecma_length_t length = ecma_string_get_ascii_size (string_p);
 
   if (length != ECMA_STRING_NO_ASCII_SIZE)
@@ -2190,6 +2766,13 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
     return lit_get_magic_string_ex_size ((uint32_t) ECMA_GET_DIRECT_STRING_VALUE (string_p) - LIT_MAGIC_STRING__COUNT);
   }
 
+#if ENABLED (JERRY_ROPE_STRINGS)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    return ((ecma_rope_string_t *) string_p)->size;
+  }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
   if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING)
   {
     return (lit_utf8_size_t) (((ecma_utf8_string_t *) string_p)->size);
@@ -2213,6 +2796,13 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
 lit_utf8_size_t
 ecma_string_get_utf8_size (const ecma_string_t *string_p) /**< ecma-string */
 {
+#if ENABLED (JERRY_ROPE_STRINGS)
+  if (ECMA_STRING_IS_ROPE (string_p))
+  {
+    string_p = ecma_rope_string_flatten (string_p);
+  }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
   ecma_length_t length = ecma_string_get_ascii_size (string_p);
 
   if (length != ECMA_STRING_NO_ASCII_SIZE)
@@ -2297,6 +2887,13 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
 
   lit_utf8_byte_t uint32_to_string_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32];
 
+#if ENABLED (JERRY_ROPE_STRINGS)
+  if (ECMA_STRING_IS_ROPE (string_p))
+  {
+    string_p = ecma_rope_string_flatten (string_p);
+  }
+#endif /* ENABLED (JERRY_ROPE_STRINGS) */
+
   if (ECMA_IS_DIRECT_STRING (string_p))
   {
     switch (ECMA_GET_DIRECT_STRING_TYPE (string_p))
@@ -2342,7 +2939,9 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
         return (ecma_char_t) data_p[index];
       }
 
-      return lit_utf8_string_code_unit_at (data_p, size, index);
+      ecma_char_t code_unit;
+      lit_read_code_unit_from_utf8 (data_p + ecma_string_index_to_offset (string_p, data_p, size, index), &code_unit);
+      return code_unit;
     }
     case ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING:
     {
@@ -2355,7 +2954,9 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
         return (ecma_char_t) data_p[index];
       }
 
-      return lit_utf8_string_code_unit_at (data_p, size, index);
+      ecma_char_t code_unit;
+      lit_read_code_unit_from_utf8 (data_p + ecma_string_index_to_offset (string_p, data_p, size, index), &code_unit);
+      return code_unit;
     }
     case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
     {
@@ -2448,18 +3049,10 @@ ecma_string_substr (const ecma_string_t *string_p, /**< pointer to an ecma strin
   }
   else
   {
-    while (start_pos--)
-    {
-      start_p += lit_get_unicode_char_size_by_utf8_first_byte (*start_p);
-    }
-
-    const lit_utf8_byte_t *end_p = start_p;
-    while (end_pos--)
-    {
-      end_p += lit_get_unicode_char_size_by_utf8_first_byte (*end_p);
-    }
+    lit_utf8_size_t start_offset = ecma_string_index_to_offset (string_p, start_p, buffer_size, start_pos);
+    lit_utf8_size_t end_offset = ecma_string_index_to_offset (string_p, start_p, buffer_size, start_pos + end_pos);
 
-    ecma_string_p = ecma_new_ecma_string_from_utf8 (start_p, (lit_utf8_size_t) (end_p - start_p));
+    ecma_string_p = ecma_new_ecma_string_from_utf8 (start_p + start_offset, end_offset - start_offset);
   }
 
   ECMA_FINALIZE_UTF8_STRING (start_p, buffer_size);
@@ -285,9 +285,32 @@ ecma_are_values_integer_numbers (ecma_value_t first_value, /**< first ecma value
 inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_float_number (ecma_value_t value) /**< ecma value */
 {
+#if ENABLED (JERRY_DIRECT_FLOAT)
+  return ((value & (ECMA_VALUE_TYPE_MASK - 0x4)) == ECMA_TYPE_FLOAT);
+#else /* !ENABLED (JERRY_DIRECT_FLOAT) */
   return (ecma_get_value_type_field (value) == ECMA_TYPE_FLOAT);
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
 } /* ecma_is_value_float_number */
 
+#if ENABLED (JERRY_DIRECT_FLOAT)
+
+JERRY_STATIC_ASSERT ((ECMA_TYPE_FLOAT | 0x4) == ECMA_TYPE_DIRECT_FLOAT,
+                     ecma_type_float_and_direct_float_must_have_one_bit_difference);
+
+/**
+ * Check if the value is a directly encoded floating-point ecma-number.
+ *
+ * @return true - if the value contains a direct float value,
+ *         false - otherwise
+ */
+inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
+ecma_is_value_direct_float (ecma_value_t value) /**< ecma value */
+{
+  return (ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT_FLOAT);
+} /* ecma_is_value_direct_float */
+
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
+
 /**
  * Check if the value is ecma-number.
  *
@@ -476,14 +499,83 @@ ecma_make_integer_value (ecma_integer_value_t integer_value) /**< integer number
   return (((ecma_value_t) integer_value) << ECMA_DIRECT_SHIFT) | ECMA_DIRECT_TYPE_INTEGER_VALUE;
 } /* ecma_make_integer_value */
 
+#if ENABLED (JERRY_DIRECT_FLOAT)
+
+/**
+ * Encode a float number into a direct float value if the number is exactly
+ * representable as a float whose lowest ECMA_VALUE_SHIFT bits are zero.
+ *
+ * Note:
+ *   the sign, the exponent and the upper mantissa bits of the float are
+ *   stored in place, and the freed lowest bits hold the value type
+ *
+ * @return direct float value - if the number can be encoded
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static inline ecma_value_t JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
+ecma_make_direct_float_value (ecma_number_t ecma_number) /**< number to be encoded */
+{
+  ecma_direct_float_accessor_t float_u;
+  float_u.as_float = (float) ecma_number;
+
+  if (float_u.as_uint32_t & ECMA_VALUE_TYPE_MASK)
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+
+  /* The comparison is bitwise, so -0 is kept and NaN is encoded only if its payload is preserved. */
+  ecma_number_accessor_t number_u;
+  ecma_number_accessor_t float_number_u;
+  number_u.as_ecma_number_t = ecma_number;
+  float_number_u.as_ecma_number_t = (ecma_number_t) float_u.as_float;
+
+#if ENABLED (JERRY_NUMBER_TYPE_FLOAT64)
+  if (number_u.as_uint64_t != float_number_u.as_uint64_t)
+#else /* !ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+  if (number_u.as_uint32_t != float_number_u.as_uint32_t)
+#endif /* ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+  {
+    return ECMA_VALUE_EMPTY;
+  }
+
+  return float_u.as_uint32_t | ECMA_TYPE_DIRECT_FLOAT;
+} /* ecma_make_direct_float_value */
+
 /**
- * Allocate and initialize a new float number without checks.
+ * Get the number of a direct float value
+ *
+ * @return floating point value
+ */
+static inline ecma_number_t JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
+ecma_get_number_from_direct_float (ecma_value_t value) /**< direct float value */
+{
+  JERRY_ASSERT (ecma_is_value_direct_float (value));
+
+  ecma_direct_float_accessor_t float_u;
+  float_u.as_uint32_t = value & ~ECMA_VALUE_TYPE_MASK;
+  return (ecma_number_t) float_u.as_float;
+} /* ecma_get_number_from_direct_float */
+
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
+
+/**
+ * Create a new float number value, which is either a direct float value
+ * or a newly allocated number.
  *
  * @return ecma-value
  */
 static ecma_value_t
 ecma_create_float_number (ecma_number_t ecma_number) /**< value of the float number */
 {
+#if ENABLED (JERRY_DIRECT_FLOAT)
+  ecma_value_t direct_value = ecma_make_direct_float_value (ecma_number);
+
+  if (direct_value != ECMA_VALUE_EMPTY)
+  {
+    return direct_value;
+  }
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
+
   ecma_number_t *ecma_num_p = ecma_alloc_number ();
 
   *ecma_num_p = ecma_number;
@@ -697,7 +789,14 @@ ecma_get_integer_from_value (ecma_value_t value) /**< ecma value */
 inline ecma_number_t JERRY_ATTR_PURE JERRY_ATTR_ALWAYS_INLINE
 ecma_get_float_from_value (ecma_value_t value) /**< ecma value */
 {
-  JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_FLOAT);
+  JERRY_ASSERT (ecma_is_value_float_number (value));
+
+#if ENABLED (JERRY_DIRECT_FLOAT)
+  if (ecma_is_value_direct_float (value))
+  {
+    return ecma_get_number_from_direct_float (value);
+  }
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
 
   return *(ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
 } /* ecma_get_float_from_value */
@@ -834,8 +933,10 @@ ecma_copy_value (ecma_value_t value)  /**< value description */
     case ECMA_TYPE_FLOAT:
     {
       ecma_number_t *num_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
+      ecma_number_t *new_num_p = ecma_alloc_number ();
 
-      return ecma_create_float_number (*num_p);
+      *new_num_p = *num_p;
+      return ecma_make_float_value (new_num_p);
     }
     case ECMA_TYPE_STRING:
     {
@@ -857,7 +958,8 @@ ecma_copy_value (ecma_value_t value)  /**< value description */
     default:
     {
       JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT
-                    || ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT_STRING);
+                    || ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT_STRING
+                    || ECMA_ASSERT_VALUE_IS_DIRECT_FLOAT (value));
 
       return value;
     }
@@ -943,8 +1045,8 @@ ecma_value_assign_value (ecma_value_t *value_p, /**< [in, out] ecma value */
   {
     *value_p = ecma_value;
   }
-  else if (ecma_is_value_float_number (ecma_value)
-           && ecma_is_value_float_number (*value_p))
+  else if (ecma_get_value_type_field (ecma_value) == ECMA_TYPE_FLOAT
+           && ecma_get_value_type_field (*value_p) == ECMA_TYPE_FLOAT)
   {
     const ecma_number_t *num_src_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (ecma_value);
     ecma_number_t *num_dst_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (*value_p);
@@ -972,6 +1074,13 @@ ecma_update_float_number (ecma_value_t float_value, /**< original float value */
 {
   JERRY_ASSERT (ecma_is_value_float_number (float_value));
 
+#if ENABLED (JERRY_DIRECT_FLOAT)
+  if (ecma_is_value_direct_float (float_value))
+  {
+    return ecma_make_number_value (new_number);
+  }
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
+
   ecma_integer_value_t integer_number = (ecma_integer_value_t) new_number;
   ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (float_value);
 
@@ -983,6 +1092,16 @@ ecma_update_float_number (ecma_value_t float_value, /**< original float value */
     return ecma_make_integer_value (integer_number);
   }
 
+#if ENABLED (JERRY_DIRECT_FLOAT)
+  ecma_value_t direct_value = ecma_make_direct_float_value (new_number);
+
+  if (direct_value != ECMA_VALUE_EMPTY)
+  {
+    ecma_dealloc_number (number_p);
+    return direct_value;
+  }
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
+
   *number_p = new_number;
   return float_value;
 } /* ecma_update_float_number */
@@ -997,7 +1116,18 @@ static void
 ecma_value_assign_float_number (ecma_value_t *value_p, /**< [in, out] ecma value */
                                 ecma_number_t ecma_number) /**< number to assign */
 {
-  if (ecma_is_value_float_number (*value_p))
+#if ENABLED (JERRY_DIRECT_FLOAT)
+  ecma_value_t direct_value = ecma_make_direct_float_value (ecma_number);
+
+  if (direct_value != ECMA_VALUE_EMPTY)
+  {
+    ecma_free_value_if_not_object (*value_p);
+    *value_p = direct_value;
+    return;
+  }
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
+
+  if (ecma_get_value_type_field (*value_p) == ECMA_TYPE_FLOAT)
   {
     ecma_number_t *num_dst_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (*value_p);
 
@@ -1079,7 +1209,8 @@ ecma_free_value (ecma_value_t value) /**< value description */
     default:
     {
       JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT
-                    || ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT_STRING);
+                    || ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT_STRING
+                    || ECMA_ASSERT_VALUE_IS_DIRECT_FLOAT (value));
 
       /* no memory is allocated */
       break;
@@ -1125,7 +1256,7 @@ ecma_free_number (ecma_value_t value) /**< value description */
 {
   JERRY_ASSERT (ecma_is_value_number (value));
 
-  if (ecma_is_value_float_number (value))
+  if (ecma_get_value_type_field (value) == ECMA_TYPE_FLOAT)
   {
     ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
     ecma_dealloc_number (number_p);
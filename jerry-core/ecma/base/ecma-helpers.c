@@ -20,6 +20,7 @@
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
 #include "ecma-property-hashmap.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 #include "jrt-bit-fields.h"
 #include "byte-code.h"
@@ -389,6 +390,24 @@ ecma_create_property (ecma_object_t *object_p, /**< the object */
   JERRY_ASSERT (name_p != NULL);
   JERRY_ASSERT (object_p != NULL);
 
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  /* The value of the new property is often initialized by the caller without a write barrier. */
+  ecma_gc_remember_object (object_p);
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  ecma_property_value_t *shape_value_p = ecma_shape_create_property (object_p,
+                                                                     name_p,
+                                                                     type_and_flags,
+                                                                     value,
+                                                                     out_prop_p);
+
+  if (shape_value_p != NULL)
+  {
+    return shape_value_p;
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
   jmem_cpointer_t *property_list_head_p = &object_p->u1.property_list_cp;
 
   if (*property_list_head_p != ECMA_NULL_POINTER)
@@ -602,11 +621,12 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
 
   jmem_cpointer_t prop_iter_cp = obj_p->u1.property_list_cp;
 
-#if ENABLED (JERRY_PROPRETY_HASHMAP)
+#if ENABLED (JERRY_PROPRETY_HASHMAP) || ENABLED (JERRY_OBJECT_SHAPES)
   if (prop_iter_cp != JMEM_CP_NULL)
   {
     ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
                                                                      prop_iter_cp);
+#if ENABLED (JERRY_PROPRETY_HASHMAP)
     if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
     {
       jmem_cpointer_t property_real_name_cp;
@@ -622,9 +642,26 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
 #endif /* ENABLED (JERRY_LCACHE) */
       return property_p;
     }
-  }
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+    {
+      jmem_cpointer_t property_real_name_cp;
+      property_p = ecma_shape_find_property (prop_iter_p, name_p, &property_real_name_cp);
+#if ENABLED (JERRY_LCACHE)
+      if (property_p != NULL
+          && !ecma_is_property_lcached (property_p))
+      {
+        ecma_lcache_insert (obj_p, property_real_name_cp, property_p);
+      }
+#endif /* ENABLED (JERRY_LCACHE) */
+      return property_p;
+    }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+  }
+#endif /* ENABLED (JERRY_PROPRETY_HASHMAP) || ENABLED (JERRY_OBJECT_SHAPES) */
+
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
   uint32_t steps = 0;
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
@@ -817,6 +854,14 @@ void
 ecma_delete_property (ecma_object_t *object_p, /**< object */
                       ecma_property_value_t *prop_value_p) /**< property value reference */
 {
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ecma_object_has_shape (object_p))
+  {
+    /* The other objects which have the same shape keep the property. */
+    prop_value_p = ecma_shape_convert_to_normal (object_p, prop_value_p);
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
   jmem_cpointer_t cur_prop_cp = object_p->u1.property_list_cp;
 
   ecma_property_header_t *prev_prop_p = NULL;
@@ -924,6 +969,28 @@ ecma_assert_object_contains_the_property (const ecma_object_t *object_p, /**< ec
 
   ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+  {
+    ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, prop_iter_p->next_property_cp);
+    ecma_shape_slot_pair_t *slot_pairs_p = ECMA_SHAPE_GET_SLOT_PAIRS (prop_iter_p);
+    uint32_t slot_pair_count = ECMA_SHAPE_GET_SLOT_PAIR_COUNT (shape_p->property_count);
+
+    for (uint32_t i = 0; i < slot_pair_count; i++)
+    {
+      for (int j = 0; j < ECMA_PROPERTY_PAIR_ITEM_COUNT; j++)
+      {
+        if ((slot_pairs_p[i].values + j) == prop_value_p)
+        {
+          JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (slot_pairs_p[i].header.types[j]) == type);
+          return;
+        }
+      }
+    }
+    return;
+  }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
   if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
   {
     prop_iter_cp = prop_iter_p->next_property_cp;
@@ -968,6 +1035,7 @@ ecma_named_data_property_assign_value (ecma_object_t *obj_p, /**< object */
 {
   ecma_assert_object_contains_the_property (obj_p, prop_value_p, ECMA_PROPERTY_TYPE_NAMEDDATA);
 
+  ECMA_GC_WRITE_BARRIER (obj_p, value);
   ecma_value_assign_value (&prop_value_p->value, value);
 } /* ecma_named_data_property_assign_value */
 
@@ -1004,6 +1072,11 @@ ecma_set_named_accessor_property_getter (ecma_object_t *object_p, /**< the prope
 #else /* !ENABLED (JERRY_CPOINTER_32_BIT) */
   ECMA_SET_POINTER (prop_value_p->getter_setter_pair.getter_cp, getter_p);
 #endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
+
+  if (getter_p != NULL)
+  {
+    ECMA_GC_WRITE_BARRIER (object_p, ecma_make_object_value (getter_p));
+  }
 } /* ecma_set_named_accessor_property_getter */
 
 /**
@@ -1024,6 +1097,11 @@ ecma_set_named_accessor_property_setter (ecma_object_t *object_p, /**< the prope
 #else /* !ENABLED (JERRY_CPOINTER_32_BIT) */
   ECMA_SET_POINTER (prop_value_p->getter_setter_pair.setter_cp, setter_p);
 #endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
+
+  if (setter_p != NULL)
+  {
+    ECMA_GC_WRITE_BARRIER (object_p, ecma_make_object_value (setter_p));
+  }
 } /* ecma_set_named_accessor_property_setter */
 
 /**
@@ -192,6 +192,18 @@ typedef enum
 #define ECMA_ASSERT_VALUE_IS_SYMBOL(value) (false)
 #endif /* ENABLED (JERRY_ES2015) */
 
+#if ENABLED (JERRY_DIRECT_FLOAT)
+/**
+ * JERRY_ASSERT compatible macro for checking whether the given ecma-value is direct float
+ */
+#define ECMA_ASSERT_VALUE_IS_DIRECT_FLOAT(value) (ecma_is_value_direct_float ((value)))
+#else /* !ENABLED (JERRY_DIRECT_FLOAT) */
+/**
+ * JERRY_ASSERT compatible macro for checking whether the given ecma-value is direct float
+ */
+#define ECMA_ASSERT_VALUE_IS_DIRECT_FLOAT(value) (false)
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
+
 /**
  * Check whether the given type is ECMA_OBJECT_TYPE_PROXY
  *
@@ -226,6 +238,9 @@ bool JERRY_ATTR_CONST ecma_is_value_array_hole (ecma_value_t value);
 bool JERRY_ATTR_CONST ecma_is_value_integer_number (ecma_value_t value);
 bool JERRY_ATTR_CONST ecma_are_values_integer_numbers (ecma_value_t first_value, ecma_value_t second_value);
 bool JERRY_ATTR_CONST ecma_is_value_float_number (ecma_value_t value);
+#if ENABLED (JERRY_DIRECT_FLOAT)
+bool JERRY_ATTR_CONST ecma_is_value_direct_float (ecma_value_t value);
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
 bool JERRY_ATTR_CONST ecma_is_value_number (ecma_value_t value);
 bool JERRY_ATTR_CONST ecma_is_value_string (ecma_value_t value);
 #if ENABLED (JERRY_ES2015)
@@ -363,6 +378,11 @@ ecma_length_t ecma_string_get_utf8_length (const ecma_string_t *string_p);
 lit_utf8_size_t ecma_string_get_size (const ecma_string_t *string_p);
 lit_utf8_size_t ecma_string_get_utf8_size (const ecma_string_t *string_p);
 ecma_char_t ecma_string_get_char_at_pos (const ecma_string_t *string_p, ecma_length_t index);
+lit_utf8_size_t ecma_string_index_to_offset (const ecma_string_t *string_p, const lit_utf8_byte_t *chars_p,
+                                             lit_utf8_size_t size, ecma_length_t index);
+#if ENABLED (JERRY_STRING_INDEX)
+void ecma_string_index_cache_free (void);
+#endif /* ENABLED (JERRY_STRING_INDEX) */
 
 lit_magic_string_id_t ecma_get_string_magic (const ecma_string_t *string_p);
 
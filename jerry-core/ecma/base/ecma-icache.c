@@ -0,0 +1,233 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-icache.h"
+#include "ecma-shape.h"
+#include "jcontext.h"
+#include "jrt-libc-includes.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaicache Inline caches
+ * @{
+ */
+
+#if ENABLED (JERRY_INLINE_CACHE)
+
+/*
+ * The inline cache of a property access instruction is the row of the inline cache table
+ * selected by the address of the instruction. An entry describes where the property is
+ * stored in the objects of a given shape: either in a slot of the object itself, or in
+ * a slot of its prototype when the prototype and the shape of the prototype are the same.
+ *
+ * The entries do not refer to objects or properties, so they are kept by the garbage
+ * collector, but a freed shape may be reused for different property names, so all
+ * entries are removed when a shape is freed.
+ */
+
+/**
+ * Compute the row index of a property access instruction
+ *
+ * @return row index
+ */
+static inline size_t JERRY_ATTR_ALWAYS_INLINE
+ecma_icache_row_index (const uint8_t *byte_code_p) /**< property access instruction */
+{
+  uintptr_t address = (uintptr_t) byte_code_p;
+
+  /* Most instructions are a few bytes long, so the low bits select the row. */
+  return (size_t) ((address ^ (address >> 7)) & (ECMA_ICACHE_ROWS_COUNT - 1));
+} /* ecma_icache_row_index */
+
+/**
+ * Insert an entry into the inline cache of an instruction. The new entry becomes
+ * the first entry of the row, and the last entry is dropped if the row is full.
+ */
+static void
+ecma_icache_insert (ecma_icache_entry_t *row_p, /**< inline cache of the instruction */
+                    jmem_cpointer_t shape_cp, /**< shape of the accessed object */
+                    jmem_cpointer_t holder_shape_cp, /**< shape of the prototype which has the property,
+                                                      *   JMEM_CP_NULL for own properties */
+                    jmem_cpointer_t prototype_cp, /**< prototype of the accessed object */
+                    uint32_t name_index) /**< index of the property name in the shape of the holder */
+{
+  JERRY_ASSERT (name_index < ECMA_SHAPE_MAX_PROPERTY_COUNT);
+
+  memmove (row_p + 1, row_p, (ECMA_ICACHE_ROW_LENGTH - 1) * sizeof (ecma_icache_entry_t));
+
+  row_p->shape_cp = shape_cp;
+  row_p->holder_shape_cp = holder_shape_cp;
+  row_p->prototype_cp = prototype_cp;
+  row_p->name_index = (uint8_t) name_index;
+
+  JERRY_CONTEXT (ecma_icache_is_used) = true;
+} /* ecma_icache_insert */
+
+/**
+ * Get the property slots of an object if the object has a shape.
+ *
+ * @return pointer to the property slots - if the object has a shape
+ *         NULL - otherwise
+ */
+static inline ecma_property_header_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_icache_get_slots (const ecma_object_t *object_p) /**< object */
+{
+  /* Only the ordinary objects have shapes, and the property list of fast arrays is a value buffer. */
+  if ((object_p->type_flags_refs & (ECMA_OBJECT_FLAG_BUILT_IN_OR_LEXICAL_ENV | ECMA_OBJECT_TYPE_MASK))
+      != ECMA_OBJECT_TYPE_GENERAL
+      || object_p->u1.property_list_cp == JMEM_CP_NULL)
+  {
+    return NULL;
+  }
+
+  ecma_property_header_t *slots_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                               object_p->u1.property_list_cp);
+
+  return (slots_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE) ? slots_p : NULL;
+} /* ecma_icache_get_slots */
+
+/**
+ * Find a property with the inline cache of a property access instruction. The instruction
+ * must pass the same name each time, but a different name only causes a cache miss.
+ *
+ * Note:
+ *      when the property is not in the cache, it is searched in the object and its
+ *      prototype, and a new entry is created if either of them has a shape
+ *
+ * @return pointer to the property of the object or its prototype - if it is found,
+ *         NULL - if the object has no shape, or the property must be searched by the caller
+ */
+ecma_property_t *
+ecma_icache_lookup (const uint8_t *byte_code_p, /**< property access instruction */
+                    ecma_object_t *object_p, /**< accessed object */
+                    ecma_string_t *name_p, /**< property name */
+                    bool is_put) /**< true - if the property is assigned,
+                                  *          only the own properties are returned
+                                  *   false - otherwise */
+{
+  ecma_property_header_t *slots_p = ecma_icache_get_slots (object_p);
+
+  if (slots_p == NULL)
+  {
+    return NULL;
+  }
+
+  jmem_cpointer_t shape_cp = slots_p->next_property_cp;
+  ecma_icache_entry_t *row_p = JERRY_CONTEXT (icache)[ecma_icache_row_index (byte_code_p)];
+  ecma_icache_entry_t *entry_p = row_p;
+  ecma_icache_entry_t *entry_end_p = row_p + ECMA_ICACHE_ROW_LENGTH;
+
+  do
+  {
+    if (entry_p->shape_cp == shape_cp)
+    {
+      ecma_property_header_t *holder_slots_p = slots_p;
+      jmem_cpointer_t holder_shape_cp = shape_cp;
+
+      if (entry_p->holder_shape_cp != JMEM_CP_NULL)
+      {
+        if (is_put || entry_p->prototype_cp != object_p->u2.prototype_cp)
+        {
+          entry_p++;
+          continue;
+        }
+
+        holder_slots_p = ecma_icache_get_slots (ECMA_GET_NON_NULL_POINTER (ecma_object_t, entry_p->prototype_cp));
+        holder_shape_cp = entry_p->holder_shape_cp;
+
+        if (holder_slots_p == NULL || holder_slots_p->next_property_cp != holder_shape_cp)
+        {
+          entry_p++;
+          continue;
+        }
+      }
+
+      ecma_shape_t *holder_shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, holder_shape_cp);
+      ecma_property_t *property_p = ECMA_SHAPE_GET_PROPERTY (holder_slots_p, entry_p->name_index);
+
+      if (ecma_string_compare_to_property_name (*property_p,
+                                                ECMA_SHAPE_GET_NAMES (holder_shape_p)[entry_p->name_index],
+                                                name_p))
+      {
+        JERRY_CONTEXT (ecma_icache_hits)++;
+        return property_p;
+      }
+    }
+
+    entry_p++;
+  }
+  while (entry_p < entry_end_p);
+
+  JERRY_CONTEXT (ecma_icache_misses)++;
+
+  uint32_t name_index = ecma_shape_find_name_index (slots_p, name_p);
+
+  if (name_index != ECMA_SHAPE_NAME_NOT_FOUND)
+  {
+    ecma_icache_insert (row_p, shape_cp, JMEM_CP_NULL, JMEM_CP_NULL, name_index);
+    return ECMA_SHAPE_GET_PROPERTY (slots_p, name_index);
+  }
+
+  jmem_cpointer_t prototype_cp = object_p->u2.prototype_cp;
+
+  if (is_put || prototype_cp == JMEM_CP_NULL)
+  {
+    return NULL;
+  }
+
+  /* The shape of the object proves that the object has no such property. */
+  ecma_property_header_t *prototype_slots_p = ecma_icache_get_slots (ECMA_GET_NON_NULL_POINTER (ecma_object_t,
+                                                                                                prototype_cp));
+
+  if (prototype_slots_p == NULL)
+  {
+    return NULL;
+  }
+
+  name_index = ecma_shape_find_name_index (prototype_slots_p, name_p);
+
+  if (name_index == ECMA_SHAPE_NAME_NOT_FOUND)
+  {
+    return NULL;
+  }
+
+  ecma_icache_insert (row_p, shape_cp, prototype_slots_p->next_property_cp, prototype_cp, name_index);
+  return ECMA_SHAPE_GET_PROPERTY (prototype_slots_p, name_index);
+} /* ecma_icache_lookup */
+
+/**
+ * Remove all entries of the inline caches
+ */
+void
+ecma_icache_invalidate_all (void)
+{
+  if (!JERRY_CONTEXT (ecma_icache_is_used))
+  {
+    return;
+  }
+
+  memset (JERRY_CONTEXT (icache), 0, sizeof (JERRY_CONTEXT (icache)));
+  JERRY_CONTEXT (ecma_icache_is_used) = false;
+} /* ecma_icache_invalidate_all */
+
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
+/**
+ * @}
+ * @}
+ */
@@ -41,9 +41,13 @@ void
 ecma_init (void)
 {
 #if (JERRY_GC_MARK_LIMIT != 0)
-  JERRY_CONTEXT (ecma_gc_mark_recursion_limit) = JERRY_GC_MARK_LIMIT;
+  JERRY_CONTEXT (ecma_gc_mark_stack_top) = 0;
 #endif /* (JERRY_GC_MARK_LIMIT != 0) */
 
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  ecma_gc_generational_init ();
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
+
   ecma_init_global_environment ();
 
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
@@ -83,12 +87,23 @@ ecma_finalize (void)
   {
     ecma_finalize_builtins ();
     ecma_gc_run ();
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+    ecma_gc_finish_lazy_sweep ();
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
     if (++runs >= JERRY_GC_LOOP_LIMIT)
     {
       jerry_fatal (ERR_UNTERMINATED_GC_LOOPS);
     }
   }
   while (JERRY_CONTEXT (ecma_gc_new_objects) != 0);
+
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_shape_count) == 0);
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  ecma_gc_generational_finalize ();
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
   ecma_finalize_lit_storage ();
 } /* ecma_finalize */
 
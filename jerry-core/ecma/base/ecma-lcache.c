@@ -217,6 +217,28 @@ ecma_lcache_invalidate (const ecma_object_t *object_p, /**< object */
   }
 } /* ecma_lcache_invalidate */
 
+#if ENABLED (JERRY_GC_COMPACTION)
+/**
+ * Invalidate all LCache entries
+ */
+void
+ecma_lcache_invalidate_all (void)
+{
+  for (uint32_t row = 0; row < ECMA_LCACHE_HASH_ROWS_COUNT; row++)
+  {
+    ecma_lcache_hash_entry_t *entry_p = JERRY_CONTEXT (lcache) [row];
+
+    for (uint32_t i = 0; i < ECMA_LCACHE_HASH_ROW_LENGTH; i++)
+    {
+      if (entry_p[i].id != 0)
+      {
+        ecma_lcache_invalidate_entry (entry_p + i);
+      }
+    }
+  }
+} /* ecma_lcache_invalidate_all */
+#endif /* ENABLED (JERRY_GC_COMPACTION) */
+
 #endif /* ENABLED (JERRY_LCACHE) */
 
 /**
@@ -19,25 +19,381 @@
 #include "jcontext.h"
 #include "jerry_literal_cache.h"
 
-void InitJerryLiteralCache(void) {}
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmalitstorage Literal storage
+ * @{
+ */
+
+/**
+ * Checks whether two numbers have the same binary representation.
+ *
+ * Note:
+ *      unlike the == operator, this comparison distinguishes 0 from -0 and finds NaN
+ *
+ * @return true - if the numbers are bit-exact equal
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_lit_number_is_same (ecma_number_t left, /**< first number */
+                         ecma_number_t right) /**< second number */
+{
+  ecma_number_accessor_t left_u;
+  ecma_number_accessor_t right_u;
+  left_u.as_ecma_number_t = left;
+  right_u.as_ecma_number_t = right;
 
-void ClearJerryLiteralCache(void) {}
+#if ENABLED (JERRY_NUMBER_TYPE_FLOAT64)
+  return left_u.as_uint64_t == right_u.as_uint64_t;
+#else /* !ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+  return left_u.as_uint32_t == right_u.as_uint32_t;
+#endif /* ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+} /* ecma_lit_number_is_same */
 
-void AddJerryLiteralCache(int32_t hash, void *p) {}
+#if ENABLED (JERRY_LIT_HASH_TABLE)
 
-void DelJerryLiteralCache(int32_t hash) {}
+JERRY_STATIC_ASSERT ((ECMA_LIT_HASH_TABLE_INITIAL_SIZE & (ECMA_LIT_HASH_TABLE_INITIAL_SIZE - 1)) == 0,
+                     ecma_lit_hash_table_initial_size_must_be_a_power_of_2);
 
-void *GetJerryLiteralCache(int32_t hash)
+/**
+ * Compute the hash of the value stored in a slot of a literal hash table.
+ */
+typedef uint32_t (*ecma_lit_hash_table_hash_t) (jmem_cpointer_t value_cp);
+
+/**
+ * Get the hash of a literal string stored in a slot of the literal string table.
+ *
+ * @return hash of the string
+ */
+static uint32_t
+ecma_lit_string_table_hash (jmem_cpointer_t value_cp) /**< literal string */
 {
-  return (void*)UINT32_MAX;
+  return JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, value_cp)->u.hash;
+} /* ecma_lit_string_table_hash */
+
+/**
+ * Compute the hash of a number from its binary representation.
+ *
+ * @return hash of the number
+ */
+static uint32_t
+ecma_lit_number_hash (ecma_number_t number) /**< number */
+{
+  ecma_number_accessor_t u;
+  u.as_ecma_number_t = number;
+
+#if ENABLED (JERRY_NUMBER_TYPE_FLOAT64)
+  uint64_t bits = u.as_uint64_t;
+#else /* !ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+  uint64_t bits = u.as_uint32_t;
+#endif /* ENABLED (JERRY_NUMBER_TYPE_FLOAT64) */
+
+  /* The low fraction bits of most literals are zero, so all bits are mixed into the upper half. */
+  return (uint32_t) ((bits * 0x9e3779b97f4a7c15ull) >> 32);
+} /* ecma_lit_number_hash */
+
+/**
+ * Get the hash of a literal number stored in a slot of the literal number table.
+ *
+ * @return hash of the number
+ */
+static uint32_t
+ecma_lit_number_table_hash (jmem_cpointer_t value_cp) /**< literal number */
+{
+  return ecma_lit_number_hash (*JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t, value_cp));
+} /* ecma_lit_number_table_hash */
+
+/**
+ * Free the slots of a literal hash table.
+ */
+static void
+ecma_lit_hash_table_free (ecma_lit_hash_table_t *table_p) /**< literal hash table */
+{
+  if (table_p->slots_p != NULL)
+  {
+    jmem_heap_free_block (table_p->slots_p, table_p->size * sizeof (jmem_cpointer_t));
+  }
+
+  table_p->slots_p = NULL;
+  table_p->size = 0;
+  table_p->count = 0;
+} /* ecma_lit_hash_table_free */
+
+/**
+ * Store a value in the first free slot of its probe sequence.
+ */
+static void
+ecma_lit_hash_table_insert (jmem_cpointer_t *slots_p, /**< slots of a literal hash table */
+                            uint32_t mask, /**< number of slots minus one */
+                            jmem_cpointer_t value_cp, /**< literal value */
+                            ecma_lit_hash_table_hash_t hash_fn) /**< hash function of the table */
+{
+  uint32_t index = hash_fn (value_cp) & mask;
+
+  while (slots_p[index] != JMEM_CP_NULL)
+  {
+    index = (index + 1) & mask;
+  }
+
+  slots_p[index] = value_cp;
+} /* ecma_lit_hash_table_insert */
+
+/**
+ * Double the size of a literal hash table, or allocate it if it is not allocated yet.
+ *
+ * @return true - if the table is grown
+ *         false - if there is not enough memory
+ */
+static bool
+ecma_lit_hash_table_grow (ecma_lit_hash_table_t *table_p, /**< literal hash table */
+                          ecma_lit_hash_table_hash_t hash_fn) /**< hash function of the table */
+{
+  uint32_t old_size = table_p->size;
+  uint32_t new_size = (old_size == 0) ? ECMA_LIT_HASH_TABLE_INITIAL_SIZE : (old_size * 2);
+
+  jmem_cpointer_t *new_slots_p;
+  new_slots_p = (jmem_cpointer_t *) jmem_heap_alloc_block_null_on_error (new_size * sizeof (jmem_cpointer_t));
+
+  if (new_slots_p == NULL)
+  {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < new_size; i++)
+  {
+    new_slots_p[i] = JMEM_CP_NULL;
+  }
+
+  jmem_cpointer_t *old_slots_p = table_p->slots_p;
+
+  for (uint32_t i = 0; i < old_size; i++)
+  {
+    if (old_slots_p[i] != JMEM_CP_NULL)
+    {
+      ecma_lit_hash_table_insert (new_slots_p, new_size - 1, old_slots_p[i], hash_fn);
+    }
+  }
+
+  if (old_slots_p != NULL)
+  {
+    jmem_heap_free_block (old_slots_p, old_size * sizeof (jmem_cpointer_t));
+  }
+
+  table_p->slots_p = new_slots_p;
+  table_p->size = new_size;
+  return true;
+} /* ecma_lit_hash_table_grow */
+
+/**
+ * Add a value to a literal hash table.
+ *
+ * Note:
+ *      if the table cannot be grown, it is freed and disabled
+ */
+static void
+ecma_lit_hash_table_add (ecma_lit_hash_table_t *table_p, /**< literal hash table */
+                         jmem_cpointer_t value_cp, /**< literal value */
+                         ecma_lit_hash_table_hash_t hash_fn) /**< hash function of the table */
+{
+  if (table_p->is_disabled)
+  {
+    return;
+  }
+
+  /* The table is kept at most three quarters full, so the probe sequences stay short. */
+  if ((table_p->count + 1) * 4 > table_p->size * 3
+      && !ecma_lit_hash_table_grow (table_p, hash_fn))
+  {
+    /* Without a complete table the literal storage must be scanned. */
+    ecma_lit_hash_table_free (table_p);
+    table_p->is_disabled = true;
+    return;
+  }
+
+  ecma_lit_hash_table_insert (table_p->slots_p, table_p->size - 1, value_cp, hash_fn);
+  table_p->count++;
+} /* ecma_lit_hash_table_add */
+
+/**
+ * Find a number in the literal number table.
+ *
+ * @return literal number - if the number is found
+ *         NULL - otherwise
+ */
+static ecma_number_t *
+ecma_lit_number_table_find (ecma_number_t number) /**< number */
+{
+  ecma_lit_hash_table_t *table_p = &JERRY_CONTEXT (lit_number_table);
+
+  if (table_p->slots_p == NULL)
+  {
+    return NULL;
+  }
+
+  uint32_t mask = table_p->size - 1;
+  uint32_t index = ecma_lit_number_hash (number) & mask;
+
+  while (table_p->slots_p[index] != JMEM_CP_NULL)
+  {
+    ecma_number_t *number_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t, table_p->slots_p[index]);
+
+    if (ecma_lit_number_is_same (*number_p, number))
+    {
+      return number_p;
+    }
+
+    index = (index + 1) & mask;
+  }
+
+  return NULL;
+} /* ecma_lit_number_table_find */
+
+#endif /* ENABLED (JERRY_LIT_HASH_TABLE) */
+
+/**
+ * Initialize the literal cache.
+ */
+void InitJerryLiteralCache(void)
+{
+#if ENABLED (JERRY_LIT_HASH_TABLE)
+  memset (&JERRY_CONTEXT (lit_string_table), 0, sizeof (ecma_lit_hash_table_t));
+  memset (&JERRY_CONTEXT (lit_number_table), 0, sizeof (ecma_lit_hash_table_t));
+#endif /* ENABLED (JERRY_LIT_HASH_TABLE) */
 }
 
-/** \addtogroup ecma ECMA
- * @{
+/**
+ * Remove all literals from the literal cache.
+ */
+void ClearJerryLiteralCache(void)
+{
+#if ENABLED (JERRY_LIT_HASH_TABLE)
+  ecma_lit_hash_table_free (&JERRY_CONTEXT (lit_string_table));
+  ecma_lit_hash_table_free (&JERRY_CONTEXT (lit_number_table));
+  JERRY_CONTEXT (lit_string_table).is_disabled = false;
+  JERRY_CONTEXT (lit_number_table).is_disabled = false;
+#endif /* ENABLED (JERRY_LIT_HASH_TABLE) */
+}
+
+/**
+ * Add a literal string to the literal cache.
+ */
+void AddJerryLiteralCache(int32_t hash, void *p)
+{
+#if ENABLED (JERRY_LIT_HASH_TABLE)
+  ecma_string_t *string_p = (ecma_string_t *) p;
+  JERRY_ASSERT ((int32_t) string_p->u.hash == hash);
+  JERRY_UNUSED (hash);
+
+  jmem_cpointer_t string_cp;
+  JMEM_CP_SET_NON_NULL_POINTER (string_cp, string_p);
+  ecma_lit_hash_table_add (&JERRY_CONTEXT (lit_string_table), string_cp, ecma_lit_string_table_hash);
+#else /* !ENABLED (JERRY_LIT_HASH_TABLE) */
+  JERRY_UNUSED (hash);
+  JERRY_UNUSED (p);
+#endif /* ENABLED (JERRY_LIT_HASH_TABLE) */
+}
+
+/**
+ * Remove a literal string with the given hash from the literal cache.
+ */
+void DelJerryLiteralCache(int32_t hash)
+{
+#if ENABLED (JERRY_LIT_HASH_TABLE)
+  ecma_lit_hash_table_t *table_p = &JERRY_CONTEXT (lit_string_table);
+
+  if (table_p->slots_p == NULL)
+  {
+    return;
+  }
+
+  jmem_cpointer_t *slots_p = table_p->slots_p;
+  uint32_t mask = table_p->size - 1;
+  uint32_t index = (uint32_t) hash & mask;
+
+  while (slots_p[index] != JMEM_CP_NULL)
+  {
+    if ((int32_t) ecma_lit_string_table_hash (slots_p[index]) == hash)
+    {
+      break;
+    }
+
+    index = (index + 1) & mask;
+  }
+
+  if (slots_p[index] == JMEM_CP_NULL)
+  {
+    return;
+  }
+
+  slots_p[index] = JMEM_CP_NULL;
+  table_p->count--;
+
+  /* Move back the following items of the cluster which cannot be found through the freed slot anymore. */
+  uint32_t free_index = index;
+  index = (index + 1) & mask;
+
+  while (slots_p[index] != JMEM_CP_NULL)
+  {
+    uint32_t home_index = ecma_lit_string_table_hash (slots_p[index]) & mask;
+
+    if (((index - home_index) & mask) >= ((index - free_index) & mask))
+    {
+      slots_p[free_index] = slots_p[index];
+      slots_p[index] = JMEM_CP_NULL;
+      free_index = index;
+    }
+
+    index = (index + 1) & mask;
+  }
+#else /* !ENABLED (JERRY_LIT_HASH_TABLE) */
+  JERRY_UNUSED (hash);
+#endif /* ENABLED (JERRY_LIT_HASH_TABLE) */
+}
+
+/**
+ * Get a literal string with the given hash from the literal cache.
  *
- * \addtogroup ecmalitstorage Literal storage
- * @{
+ * @return literal string - if a literal string with the given hash is found
+ *         NULL - if there is no literal string with the given hash
+ *         UINT32_MAX - if the literal cache is not available, so the literal storage must be scanned
  */
+void *GetJerryLiteralCache(int32_t hash)
+{
+#if ENABLED (JERRY_LIT_HASH_TABLE)
+  ecma_lit_hash_table_t *table_p = &JERRY_CONTEXT (lit_string_table);
+
+  if (table_p->is_disabled)
+  {
+    return (void*)UINT32_MAX;
+  }
+
+  if (table_p->slots_p == NULL)
+  {
+    return NULL;
+  }
+
+  uint32_t mask = table_p->size - 1;
+  uint32_t index = (uint32_t) hash & mask;
+
+  while (table_p->slots_p[index] != JMEM_CP_NULL)
+  {
+    ecma_string_t *string_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, table_p->slots_p[index]);
+
+    if ((int32_t) string_p->u.hash == hash)
+    {
+      return string_p;
+    }
+
+    index = (index + 1) & mask;
+  }
+
+  return NULL;
+#else /* !ENABLED (JERRY_LIT_HASH_TABLE) */
+  JERRY_UNUSED (hash);
+  return (void*)UINT32_MAX;
+#endif /* ENABLED (JERRY_LIT_HASH_TABLE) */
+}
 
 #if ENABLED (JERRY_ES2015)
 /**
@@ -87,7 +443,6 @@ ecma_free_string_list (jmem_cpointer_t string_list_cp) /**< string list */
                                                                 string_list_p->values[i]);
 
         JERRY_ASSERT (ECMA_STRING_IS_REF_EQUALS_TO_ONE (string_p));
-        DelJerryLiteralCache(string_p->u.hash);
         ecma_destroy_ecma_string (string_p);
       }
     }
@@ -133,6 +488,7 @@ ecma_finalize_lit_storage (void)
 #if ENABLED (JERRY_ES2015)
   ecma_free_symbol_list (JERRY_CONTEXT (symbol_list_first_cp));
 #endif /* ENABLED (JERRY_ES2015) */
+  ClearJerryLiteralCache ();
   ecma_free_string_list (JERRY_CONTEXT (string_list_first_cp));
   ecma_free_number_list (JERRY_CONTEXT (number_list_first_cp));
 } /* ecma_finalize_lit_storage */
@@ -152,11 +508,21 @@ ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string
     return ecma_make_string_value (string_desc_p);
   }
 
-  ecma_string_t *nonref_string_p = ecma_new_nonref_ecma_string_from_utf8(chars_p, size);
-  ecma_string_t *cached_literal = (ecma_string_t *)GetJerryLiteralCache(nonref_string_p->u.hash);
-  if ((cached_literal != NULL) && (cached_literal != (void*)UINT32_MAX)) {
-    if (ecma_compare_ecma_strings_with_literal (nonref_string_p, cached_literal,chars_p)) {
-       return ecma_make_string_value (cached_literal);
+  ecma_string_t *cached_literal = (ecma_string_t *) (void*)UINT32_MAX;
+
+  if (string_desc_p != NULL)
+  {
+    /* The descriptor of these strings holds no hash, so they are not cached and the storage is scanned. */
+    ecma_deref_ecma_string (string_desc_p);
+  }
+  else
+  {
+    ecma_string_t *nonref_string_p = ecma_new_nonref_ecma_string_from_utf8(chars_p, size);
+    cached_literal = (ecma_string_t *)GetJerryLiteralCache(nonref_string_p->u.hash);
+    if ((cached_literal != NULL) && (cached_literal != (void*)UINT32_MAX)) {
+      if (ecma_compare_ecma_strings_with_literal (nonref_string_p, cached_literal,chars_p)) {
+         return ecma_make_string_value (cached_literal);
+      }
     }
   }
 
@@ -209,7 +575,10 @@ ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string
   if (empty_cpointer_p != NULL)
   {
     *empty_cpointer_p = result;
-    AddJerryLiteralCache(string_p->u.hash, string_p);
+    if (string_desc_p == NULL)
+    {
+      AddJerryLiteralCache(string_p->u.hash, string_p);
+    }
     return ecma_make_string_value (string_p);
   }
 
@@ -225,7 +594,10 @@ ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string
   new_item_p->next_cp = JERRY_CONTEXT (string_list_first_cp);
   JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (string_list_first_cp), new_item_p);
 
-  AddJerryLiteralCache(string_p->u.hash, string_p);
+  if (string_desc_p == NULL)
+  {
+    AddJerryLiteralCache(string_p->u.hash, string_p);
+  }
   return ecma_make_string_value (string_p);
 } /* ecma_find_or_create_literal_string */
 
@@ -239,12 +611,34 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
 {
   ecma_value_t num = ecma_make_number_value (number_arg);
 
-  if (ecma_is_value_integer_number (num))
+  if (ecma_is_value_integer_number (num)
+#if ENABLED (JERRY_DIRECT_FLOAT)
+      || ecma_is_value_direct_float (num)
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
+      )
   {
     return num;
   }
 
-  JERRY_ASSERT (ecma_is_value_float_number (num));
+  JERRY_ASSERT (ecma_get_value_type_field (num) == ECMA_TYPE_FLOAT);
+
+  /* When the number is not in the literal number table, only a free slot is searched in the storage. */
+  bool compare_values = true;
+
+#if ENABLED (JERRY_LIT_HASH_TABLE)
+  if (!JERRY_CONTEXT (lit_number_table).is_disabled)
+  {
+    ecma_number_t *number_p = ecma_lit_number_table_find (number_arg);
+
+    if (number_p != NULL)
+    {
+      ecma_free_value (num);
+      return ecma_make_float_value (number_p);
+    }
+
+    compare_values = false;
+  }
+#endif /* ENABLED (JERRY_LIT_HASH_TABLE) */
 
   jmem_cpointer_t number_list_cp = JERRY_CONTEXT (number_list_first_cp);
   jmem_cpointer_t *empty_cpointer_p = NULL;
@@ -262,13 +656,18 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
         {
           empty_cpointer_p = number_list_p->values + i;
         }
+
+        if (!compare_values)
+        {
+          break;
+        }
       }
-      else
+      else if (compare_values)
       {
         ecma_number_t *number_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t,
                                                                 number_list_p->values[i]);
 
-        if (*number_p == number_arg)
+        if (ecma_lit_number_is_same (*number_p, number_arg))
         {
           ecma_free_value (num);
           return ecma_make_float_value (number_p);
@@ -276,6 +675,11 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
       }
     }
 
+    if (!compare_values && empty_cpointer_p != NULL)
+    {
+      break;
+    }
+
     number_list_cp = number_list_p->next_cp;
   }
 
@@ -284,6 +688,10 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
   jmem_cpointer_t result;
   JMEM_CP_SET_NON_NULL_POINTER (result, num_p);
 
+#if ENABLED (JERRY_LIT_HASH_TABLE)
+  ecma_lit_hash_table_add (&JERRY_CONTEXT (lit_number_table), result, ecma_lit_number_table_hash);
+#endif /* ENABLED (JERRY_LIT_HASH_TABLE) */
+
   if (empty_cpointer_p != NULL)
   {
     *empty_cpointer_p = result;
@@ -38,6 +38,15 @@ typedef struct
 } lit_mem_to_snapshot_id_map_entry_t;
 #endif /* ENABLED (JERRY_SNAPSHOT_SAVE) */
 
+#if ENABLED (JERRY_LIT_HASH_TABLE)
+
+/**
+ * Initial number of slots of the literal hash tables (must be a power of 2).
+ */
+#define ECMA_LIT_HASH_TABLE_INITIAL_SIZE 64
+
+#endif /* ENABLED (JERRY_LIT_HASH_TABLE) */
+
 void ecma_finalize_lit_storage (void);
 
 ecma_value_t ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, lit_utf8_size_t size);
@@ -0,0 +1,612 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-icache.h"
+#include "ecma-lcache.h"
+#include "ecma-shape.h"
+#include "jcontext.h"
+#include "jrt-libc-includes.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashape Object shapes
+ * @{
+ */
+
+#if ENABLED (JERRY_OBJECT_SHAPES)
+
+/**
+ * Get the size of a shape.
+ */
+#define ECMA_SHAPE_GET_SIZE(property_count) \
+  (sizeof (ecma_shape_t) + ECMA_SHAPE_GET_SLOT_PAIR_COUNT (property_count) * 2 * sizeof (jmem_cpointer_t))
+
+/**
+ * Checks whether the properties of an object can be described by a shape.
+ *
+ * @return true - if the object is an ordinary object,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_shape_is_supported_object (const ecma_object_t *object_p) /**< object */
+{
+  /* Built-in objects instantiate their properties lazily, and the other object types
+   * often have internal properties, so only the ordinary objects have shapes. */
+  return ((object_p->type_flags_refs & (ECMA_OBJECT_FLAG_BUILT_IN_OR_LEXICAL_ENV | ECMA_OBJECT_TYPE_MASK))
+          == ECMA_OBJECT_TYPE_GENERAL);
+} /* ecma_shape_is_supported_object */
+
+/**
+ * Checks whether a property name can be stored in a shape.
+ *
+ * @return true - if the name is not an internal magic string,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_shape_is_supported_name (ecma_string_t *name_p) /**< property name */
+{
+  /* The garbage collector looks up the internal properties by their name,
+   * so these are kept in the property pairs. */
+  return (!ECMA_IS_DIRECT_STRING (name_p)
+          || ECMA_GET_DIRECT_STRING_TYPE (name_p) != ECMA_DIRECT_STRING_MAGIC
+          || ECMA_GET_DIRECT_STRING_VALUE (name_p) < LIT_NON_INTERNAL_MAGIC_STRING__COUNT);
+} /* ecma_shape_is_supported_name */
+
+/**
+ * Checks whether an object has a shape.
+ *
+ * @return true - if the properties of the object are stored in property slots,
+ *         false - otherwise
+ */
+bool
+ecma_object_has_shape (const ecma_object_t *object_p) /**< object */
+{
+  /* The property list of fast arrays is a value buffer, so the type is checked first. */
+  return (ecma_shape_is_supported_object (object_p)
+          && object_p->u1.property_list_cp != JMEM_CP_NULL
+          && (ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, object_p->u1.property_list_cp)->types[0]
+              == ECMA_PROPERTY_TYPE_SHAPE));
+} /* ecma_object_has_shape */
+
+/**
+ * Decrease the reference counter of a shape, and free the shape and
+ * its parents which are not referenced anymore.
+ */
+static void
+ecma_shape_deref (ecma_shape_t *shape_p) /**< shape */
+{
+  while (true)
+  {
+    JERRY_ASSERT (shape_p->refs > 0);
+
+    if (--shape_p->refs > 0)
+    {
+      return;
+    }
+
+    /* The children hold a reference to their parent. */
+    JERRY_ASSERT (shape_p->children_cp == JMEM_CP_NULL);
+
+    ecma_shape_t *parent_p = NULL;
+    jmem_cpointer_t *list_cp_p = &JERRY_CONTEXT (ecma_shape_roots_cp);
+
+    if (shape_p->parent_cp != JMEM_CP_NULL)
+    {
+      parent_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+      list_cp_p = &parent_p->children_cp;
+    }
+
+    jmem_cpointer_t shape_cp;
+    ECMA_SET_NON_NULL_POINTER (shape_cp, shape_p);
+
+    while (*list_cp_p != shape_cp)
+    {
+      JERRY_ASSERT (*list_cp_p != JMEM_CP_NULL);
+      list_cp_p = &ECMA_GET_NON_NULL_POINTER (ecma_shape_t, *list_cp_p)->next_sibling_cp;
+    }
+
+    *list_cp_p = shape_p->next_sibling_cp;
+
+    /* Only the last name is owned by the shape, the others are owned by the parents. */
+    uint32_t property_count = shape_p->property_count;
+
+    if (ECMA_PROPERTY_GET_NAME_TYPE (shape_p->name_type) == ECMA_DIRECT_STRING_PTR)
+    {
+      jmem_cpointer_t name_cp = ECMA_SHAPE_GET_NAMES (shape_p)[(property_count - 1) ^ 0x1];
+      ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, name_cp));
+    }
+
+    jmem_heap_free_block (shape_p, ECMA_SHAPE_GET_SIZE (property_count));
+
+#if ENABLED (JERRY_INLINE_CACHE)
+    /* The inline caches must not match a new shape which is allocated at the same address. */
+    ecma_icache_invalidate_all ();
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
+    JERRY_ASSERT (JERRY_CONTEXT (ecma_shape_count) > 0);
+    JERRY_CONTEXT (ecma_shape_count)--;
+
+    if (parent_p == NULL)
+    {
+      return;
+    }
+
+    shape_p = parent_p;
+  }
+} /* ecma_shape_deref */
+
+/**
+ * Find or create the child of a shape which has the given name as its last property name.
+ *
+ * Note:
+ *      the reference counter of the returned shape is increased
+ *
+ * @return pointer to the child shape - if success
+ *         NULL - if the shape limit is reached or there is not enough memory
+ */
+static ecma_shape_t *
+ecma_shape_get_child (ecma_shape_t *parent_p, /**< parent shape, or NULL for the first level */
+                      ecma_string_t *name_p) /**< name of the new property */
+{
+  uint32_t property_count = 0;
+  jmem_cpointer_t *list_cp_p = &JERRY_CONTEXT (ecma_shape_roots_cp);
+
+  if (parent_p != NULL)
+  {
+    property_count = parent_p->property_count;
+    list_cp_p = &parent_p->children_cp;
+  }
+
+  uint32_t name_index = property_count ^ 0x1;
+  jmem_cpointer_t child_cp = *list_cp_p;
+
+  while (child_cp != JMEM_CP_NULL)
+  {
+    ecma_shape_t *child_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, child_cp);
+
+    if (ecma_string_compare_to_property_name (child_p->name_type,
+                                              ECMA_SHAPE_GET_NAMES (child_p)[name_index],
+                                              name_p))
+    {
+      JERRY_ASSERT (child_p->refs < UINT32_MAX);
+      child_p->refs++;
+      return child_p;
+    }
+
+    child_cp = child_p->next_sibling_cp;
+  }
+
+  if (JERRY_CONTEXT (ecma_shape_count) >= ECMA_SHAPE_MAX_COUNT)
+  {
+    return NULL;
+  }
+
+  /* The allocation may run the garbage collector, which frees the unreferenced shapes.
+   * The parent is not freed, since it is referenced by the object which receives the property. */
+  size_t size = ECMA_SHAPE_GET_SIZE (property_count + 1);
+  ecma_shape_t *child_p = (ecma_shape_t *) jmem_heap_alloc_block_null_on_error (size);
+
+  if (child_p == NULL)
+  {
+    return NULL;
+  }
+
+  jmem_cpointer_t *names_p = ECMA_SHAPE_GET_NAMES (child_p);
+
+  child_p->parent_cp = JMEM_CP_NULL;
+
+  if (parent_p != NULL)
+  {
+    ECMA_SET_NON_NULL_POINTER (child_p->parent_cp, parent_p);
+    parent_p->refs++;
+
+    memcpy (names_p,
+            ECMA_SHAPE_GET_NAMES (parent_p),
+            ECMA_SHAPE_GET_SLOT_PAIR_COUNT (property_count) * 2 * sizeof (jmem_cpointer_t));
+  }
+
+  if ((property_count & 0x1) == 0)
+  {
+    /* The second slot of the new slot pair is unused. */
+    names_p[property_count] = LIT_INTERNAL_MAGIC_STRING_DELETED;
+  }
+
+  names_p[name_index] = ecma_string_to_property_name (name_p, &child_p->name_type);
+
+  child_p->children_cp = JMEM_CP_NULL;
+  child_p->next_sibling_cp = *list_cp_p;
+  child_p->property_count = (uint8_t) (property_count + 1);
+  child_p->refs = 1;
+
+  ECMA_SET_NON_NULL_POINTER (*list_cp_p, child_p);
+  JERRY_CONTEXT (ecma_shape_count)++;
+
+  return child_p;
+} /* ecma_shape_get_child */
+
+#if ENABLED (JERRY_LCACHE)
+/**
+ * Invalidate the lcache entries of the properties of an object which has a shape.
+ */
+static void
+ecma_shape_invalidate_lcache (ecma_object_t *object_p, /**< object */
+                              ecma_property_header_t *slots_p, /**< property slots of the object */
+                              ecma_shape_t *shape_p) /**< shape of the object */
+{
+  ecma_shape_slot_pair_t *slot_pairs_p = ECMA_SHAPE_GET_SLOT_PAIRS (slots_p);
+  jmem_cpointer_t *names_p = ECMA_SHAPE_GET_NAMES (shape_p);
+  uint32_t name_count = ECMA_SHAPE_GET_SLOT_PAIR_COUNT (shape_p->property_count) * 2;
+
+  for (uint32_t i = 0; i < name_count; i++)
+  {
+    ecma_property_t *property_p = slot_pairs_p[i >> 1].header.types + (i & 0x1);
+
+    if (*property_p != ECMA_PROPERTY_TYPE_DELETED
+        && ecma_is_property_lcached (property_p))
+    {
+      ecma_lcache_invalidate (object_p, names_p[i], property_p);
+    }
+  }
+} /* ecma_shape_invalidate_lcache */
+#endif /* ENABLED (JERRY_LCACHE) */
+
+/**
+ * Create a property in an object which has no properties or has a shape.
+ *
+ * Note:
+ *      the property slots of the object are reallocated when a new slot pair is needed,
+ *      so the previously returned property pointers of the object become invalid
+ *
+ * @return pointer to the newly created property value - if success
+ *         NULL - if the property must be created in the property list of the object,
+ *                the object has no shape in this case
+ */
+ecma_property_value_t *
+ecma_shape_create_property (ecma_object_t *object_p, /**< the object */
+                            ecma_string_t *name_p, /**< property name */
+                            uint8_t type_and_flags, /**< type and flags, see ecma_property_info_t */
+                            ecma_property_value_t value, /**< property value */
+                            ecma_property_t **out_prop_p) /**< [out] the property is also returned
+                                                           *         if this field is non-NULL */
+{
+  ecma_property_header_t *slots_p = NULL;
+  ecma_shape_t *shape_p = NULL;
+  uint32_t property_count = 0;
+
+  if (object_p->u1.property_list_cp != JMEM_CP_NULL)
+  {
+    slots_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, object_p->u1.property_list_cp);
+
+    if (slots_p->types[0] != ECMA_PROPERTY_TYPE_SHAPE)
+    {
+      return NULL;
+    }
+
+    shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->next_property_cp);
+    property_count = shape_p->property_count;
+  }
+  else if (!ecma_shape_is_supported_object (object_p))
+  {
+    return NULL;
+  }
+
+  ecma_shape_t *new_shape_p = NULL;
+
+  if (property_count < ECMA_SHAPE_MAX_PROPERTY_COUNT
+      && ecma_shape_is_supported_name (name_p))
+  {
+    new_shape_p = ecma_shape_get_child (shape_p, name_p);
+  }
+
+  if (new_shape_p == NULL)
+  {
+    if (slots_p != NULL)
+    {
+      ecma_shape_convert_to_normal (object_p, NULL);
+    }
+    return NULL;
+  }
+
+  if ((property_count & 0x1) == 0)
+  {
+    /* A new slot pair is needed. */
+    size_t old_size = ECMA_SHAPE_GET_SLOTS_SIZE (property_count);
+    size_t new_size = ECMA_SHAPE_GET_SLOTS_SIZE (property_count + 1);
+
+#if ENABLED (JERRY_MEM_STATS)
+    jmem_stats_allocate_property_bytes (new_size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+    /* The object still refers to the old slots when the allocation runs the garbage collector. */
+    ecma_property_header_t *new_slots_p = (ecma_property_header_t *) jmem_heap_alloc_block (new_size);
+
+    if (slots_p != NULL)
+    {
+#if ENABLED (JERRY_LCACHE)
+      /* The lcache refers to the properties by their address. */
+      ecma_shape_invalidate_lcache (object_p, slots_p, shape_p);
+#endif /* ENABLED (JERRY_LCACHE) */
+
+      memcpy (new_slots_p, slots_p, old_size);
+      jmem_heap_free_block (slots_p, old_size);
+
+#if ENABLED (JERRY_MEM_STATS)
+      jmem_stats_free_property_bytes (old_size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+    }
+    else
+    {
+      new_slots_p->types[0] = ECMA_PROPERTY_TYPE_SHAPE;
+      new_slots_p->types[1] = ECMA_PROPERTY_TYPE_DELETED;
+    }
+
+    ecma_shape_slot_pair_t *slot_pair_p = ECMA_SHAPE_GET_SLOT_PAIRS (new_slots_p) + (property_count >> 1);
+
+    slot_pair_p->header.types[0] = ECMA_PROPERTY_TYPE_DELETED;
+    slot_pair_p->header.types[1] = ECMA_PROPERTY_TYPE_DELETED;
+    slot_pair_p->header.next_property_cp = JMEM_CP_NULL;
+    slot_pair_p->values[0].value = ECMA_VALUE_UNDEFINED;
+
+    slots_p = new_slots_p;
+    ECMA_SET_NON_NULL_POINTER (object_p->u1.property_list_cp, slots_p);
+  }
+
+  ECMA_SET_NON_NULL_POINTER (slots_p->next_property_cp, new_shape_p);
+
+  if (shape_p != NULL)
+  {
+    /* The new shape is a child of the old one, so the old shape is not freed. */
+    ecma_shape_deref (shape_p);
+  }
+
+  ecma_shape_slot_pair_t *slot_pair_p = ECMA_SHAPE_GET_SLOT_PAIRS (slots_p) + (property_count >> 1);
+  uint32_t index = (property_count & 0x1) ^ 0x1;
+
+  slot_pair_p->values[index] = value;
+  slot_pair_p->header.types[index] = (ecma_property_t) (type_and_flags | new_shape_p->name_type);
+
+  ecma_property_t *property_p = slot_pair_p->header.types + index;
+
+  JERRY_ASSERT (ECMA_PROPERTY_VALUE_PTR (property_p) == slot_pair_p->values + index);
+
+  if (out_prop_p != NULL)
+  {
+    *out_prop_p = property_p;
+  }
+
+  return slot_pair_p->values + index;
+} /* ecma_shape_create_property */
+
+/**
+ * Find the index of a property name in the shape of an object.
+ *
+ * @return index of the name in the shape - if it is found,
+ *         ECMA_SHAPE_NAME_NOT_FOUND - otherwise
+ */
+uint32_t
+ecma_shape_find_name_index (ecma_property_header_t *slots_p, /**< property slots of the object */
+                            ecma_string_t *name_p) /**< property name */
+{
+  JERRY_ASSERT (slots_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE);
+
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->next_property_cp);
+  jmem_cpointer_t *names_p = ECMA_SHAPE_GET_NAMES (shape_p);
+  uint32_t name_count = ECMA_SHAPE_GET_SLOT_PAIR_COUNT (shape_p->property_count) * 2;
+
+  if (ECMA_IS_DIRECT_STRING (name_p))
+  {
+    ecma_property_t prop_name_type = (ecma_property_t) ECMA_GET_DIRECT_STRING_TYPE (name_p);
+    jmem_cpointer_t property_name_cp = (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (name_p);
+
+    JERRY_ASSERT (prop_name_type > 0);
+
+    for (uint32_t i = 0; i < name_count; i++)
+    {
+      if (names_p[i] == property_name_cp)
+      {
+        ecma_property_t *property_p = ECMA_SHAPE_GET_PROPERTY (slots_p, i);
+
+        if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == prop_name_type)
+        {
+          JERRY_ASSERT (ECMA_PROPERTY_IS_NAMED_PROPERTY (*property_p));
+          return i;
+        }
+      }
+    }
+
+    return ECMA_SHAPE_NAME_NOT_FOUND;
+  }
+
+  for (uint32_t i = 0; i < name_count; i++)
+  {
+    ecma_property_t *property_p = ECMA_SHAPE_GET_PROPERTY (slots_p, i);
+
+    if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == ECMA_DIRECT_STRING_PTR)
+    {
+      ecma_string_t *prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_p[i]);
+
+      if (ecma_compare_ecma_non_direct_strings (name_p, prop_name_p))
+      {
+        return i;
+      }
+    }
+  }
+
+  return ECMA_SHAPE_NAME_NOT_FOUND;
+} /* ecma_shape_find_name_index */
+
+/**
+ * Find a named property in the property slots of an object which has a shape.
+ *
+ * @return pointer to the property - if it is found,
+ *         NULL - otherwise
+ */
+ecma_property_t *
+ecma_shape_find_property (ecma_property_header_t *slots_p, /**< property slots of the object */
+                          ecma_string_t *name_p, /**< property name */
+                          jmem_cpointer_t *property_real_name_cp) /**< [out] property name */
+{
+  uint32_t index = ecma_shape_find_name_index (slots_p, name_p);
+
+  if (index == ECMA_SHAPE_NAME_NOT_FOUND)
+  {
+    return NULL;
+  }
+
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->next_property_cp);
+
+  *property_real_name_cp = ECMA_SHAPE_GET_NAMES (shape_p)[index];
+  return ECMA_SHAPE_GET_PROPERTY (slots_p, index);
+} /* ecma_shape_find_property */
+
+/**
+ * Convert the property slots of an object which has a shape to a property pair list.
+ *
+ * Note:
+ *      the property order is kept and the object releases its shape
+ *
+ * @return the new address of the property value referenced by prop_value_p,
+ *         NULL if prop_value_p is NULL
+ */
+ecma_property_value_t *
+ecma_shape_convert_to_normal (ecma_object_t *object_p, /**< object */
+                              ecma_property_value_t *prop_value_p) /**< property value of the object
+                                                                    *   or NULL */
+{
+  JERRY_ASSERT (object_p->u1.property_list_cp != JMEM_CP_NULL);
+
+  ecma_property_header_t *slots_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                               object_p->u1.property_list_cp);
+
+  JERRY_ASSERT (slots_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE);
+
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->next_property_cp);
+  uint32_t property_count = shape_p->property_count;
+
+#if ENABLED (JERRY_LCACHE)
+  /* The lcache refers to the properties by their address. */
+  ecma_shape_invalidate_lcache (object_p, slots_p, shape_p);
+#endif /* ENABLED (JERRY_LCACHE) */
+
+  ecma_property_value_t *new_prop_value_p = NULL;
+  jmem_cpointer_t *names_p = ECMA_SHAPE_GET_NAMES (shape_p);
+  jmem_cpointer_t property_list_cp = JMEM_CP_NULL;
+  uint32_t slot_pair_count = ECMA_SHAPE_GET_SLOT_PAIR_COUNT (property_count);
+
+  /* The newest slot pair becomes the first property pair. The object still refers to the
+   * slots when the allocations run the garbage collector, so nothing is freed before the
+   * whole list is created. */
+  for (uint32_t i = 0; i < slot_pair_count; i++)
+  {
+    ecma_property_pair_t *property_pair_p = ecma_alloc_property_pair ();
+    ecma_shape_slot_pair_t *slot_pair_p = ECMA_SHAPE_GET_SLOT_PAIRS (slots_p) + i;
+
+    for (uint32_t j = 0; j < ECMA_PROPERTY_PAIR_ITEM_COUNT; j++)
+    {
+      ecma_property_t property = slot_pair_p->header.types[j];
+      jmem_cpointer_t name_cp = names_p[i * 2 + j];
+
+      if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_PTR)
+      {
+        ecma_ref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, name_cp));
+      }
+
+      property_pair_p->header.types[j] = property;
+      property_pair_p->values[j] = slot_pair_p->values[j];
+      property_pair_p->names_cp[j] = name_cp;
+
+      if (slot_pair_p->values + j == prop_value_p)
+      {
+        new_prop_value_p = property_pair_p->values + j;
+      }
+    }
+
+    property_pair_p->header.next_property_cp = property_list_cp;
+    ECMA_SET_NON_NULL_POINTER (property_list_cp, property_pair_p);
+  }
+
+  JERRY_ASSERT (prop_value_p == NULL || new_prop_value_p != NULL);
+
+  object_p->u1.property_list_cp = property_list_cp;
+
+  size_t size = ECMA_SHAPE_GET_SLOTS_SIZE (property_count);
+  jmem_heap_free_block (slots_p, size);
+
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_free_property_bytes (size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  ecma_shape_deref (shape_p);
+
+  return new_prop_value_p;
+} /* ecma_shape_convert_to_normal */
+
+/**
+ * Free the properties of an object which has a shape.
+ */
+void
+ecma_shape_free_properties (ecma_object_t *object_p) /**< object */
+{
+  ecma_property_header_t *slots_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                               object_p->u1.property_list_cp);
+
+  JERRY_ASSERT (slots_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE);
+
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->next_property_cp);
+  ecma_shape_slot_pair_t *slot_pairs_p = ECMA_SHAPE_GET_SLOT_PAIRS (slots_p);
+  jmem_cpointer_t *names_p = ECMA_SHAPE_GET_NAMES (shape_p);
+  uint32_t property_count = shape_p->property_count;
+  uint32_t name_count = ECMA_SHAPE_GET_SLOT_PAIR_COUNT (property_count) * 2;
+
+  for (uint32_t i = 0; i < name_count; i++)
+  {
+    ecma_property_t *property_p = slot_pairs_p[i >> 1].header.types + (i & 0x1);
+
+    if (*property_p == ECMA_PROPERTY_TYPE_DELETED)
+    {
+      continue;
+    }
+
+    if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == ECMA_DIRECT_STRING_PTR)
+    {
+      /* The name is owned by the shape, but ecma_free_property releases it. */
+      ecma_ref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_p[i]));
+    }
+
+    ecma_free_property (object_p, names_p[i], property_p);
+  }
+
+  object_p->u1.property_list_cp = JMEM_CP_NULL;
+
+  size_t size = ECMA_SHAPE_GET_SLOTS_SIZE (property_count);
+  jmem_heap_free_block (slots_p, size);
+
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_free_property_bytes (size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  ecma_shape_deref (shape_p);
+} /* ecma_shape_free_properties */
+
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,130 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_SHAPE_H
+#define ECMA_SHAPE_H
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashape Object shapes
+ * @{
+ */
+
+#if ENABLED (JERRY_OBJECT_SHAPES)
+
+/**
+ * Maximum number of properties of an object which has a shape.
+ */
+#define ECMA_SHAPE_MAX_PROPERTY_COUNT 16
+
+/**
+ * Maximum number of shapes.
+ */
+#define ECMA_SHAPE_MAX_COUNT 256
+
+/**
+ * Shape of ordinary objects.
+ *
+ * A shape describes the property names of the objects which created the same properties
+ * in the same order. The shapes form a transition tree: a child shape has the names of
+ * its parent and one more name. The shapes are reference counted, the references are
+ * held by the objects and by the child shapes.
+ */
+typedef struct
+{
+  jmem_cpointer_t parent_cp; /**< shape without the last property, or JMEM_CP_NULL */
+  jmem_cpointer_t children_cp; /**< first child shape */
+  jmem_cpointer_t next_sibling_cp; /**< next child shape of the parent */
+  uint8_t property_count; /**< number of property names */
+  ecma_property_t name_type; /**< name type of the last property */
+  uint32_t refs; /**< reference counter */
+
+  /*
+   * The shape is followed by the property names padded to an even count. The name of
+   * the property in slot i is stored at index (i ^ 1), so the names of a slot pair have
+   * the same layout as the names of a property pair.
+   */
+} ecma_shape_t;
+
+/**
+ * Two property slots of an object which has a shape.
+ *
+ * The layout is the same as the beginning of ecma_property_pair_t, so the value
+ * of a property can be computed from its address by ECMA_PROPERTY_VALUE_PTR.
+ */
+typedef struct
+{
+  ecma_property_header_t header; /**< types of the properties (next_property_cp is unused) */
+  ecma_property_value_t values[ECMA_PROPERTY_PAIR_ITEM_COUNT]; /**< property value slots */
+} ecma_shape_slot_pair_t;
+
+/*
+ * The property list of an object which has a shape is a single block. The block starts
+ * with an ecma_property_header_t whose first type is ECMA_PROPERTY_TYPE_SHAPE and whose
+ * next_property_cp refers to the shape, and it is followed by the slot pairs.
+ */
+
+/**
+ * Get the property names of a shape.
+ */
+#define ECMA_SHAPE_GET_NAMES(shape_p) ((jmem_cpointer_t *) ((shape_p) + 1))
+
+/**
+ * Get the slot pairs of a property slot block.
+ */
+#define ECMA_SHAPE_GET_SLOT_PAIRS(slots_p) ((ecma_shape_slot_pair_t *) ((slots_p) + 1))
+
+/**
+ * Get the property in a slot of a property slot block.
+ */
+#define ECMA_SHAPE_GET_PROPERTY(slots_p, index) \
+  (ECMA_SHAPE_GET_SLOT_PAIRS (slots_p)[(index) >> 1].header.types + ((index) & 0x1))
+
+/**
+ * Return value of ecma_shape_find_name_index when the name is not found.
+ */
+#define ECMA_SHAPE_NAME_NOT_FOUND UINT32_MAX
+
+/**
+ * Get the number of slot pairs which store the given number of properties.
+ */
+#define ECMA_SHAPE_GET_SLOT_PAIR_COUNT(property_count) (((uint32_t) (property_count) + 1) >> 1)
+
+/**
+ * Get the size of a property slot block.
+ */
+#define ECMA_SHAPE_GET_SLOTS_SIZE(property_count) \
+  (sizeof (ecma_property_header_t) \
+   + ECMA_SHAPE_GET_SLOT_PAIR_COUNT (property_count) * sizeof (ecma_shape_slot_pair_t))
+
+bool ecma_object_has_shape (const ecma_object_t *object_p);
+ecma_property_value_t *ecma_shape_create_property (ecma_object_t *object_p, ecma_string_t *name_p,
+                                                   uint8_t type_and_flags, ecma_property_value_t value,
+                                                   ecma_property_t **out_prop_p);
+uint32_t ecma_shape_find_name_index (ecma_property_header_t *slots_p, ecma_string_t *name_p);
+ecma_property_t *ecma_shape_find_property (ecma_property_header_t *slots_p, ecma_string_t *name_p,
+                                           jmem_cpointer_t *property_real_name_cp);
+ecma_property_value_t *ecma_shape_convert_to_normal (ecma_object_t *object_p, ecma_property_value_t *prop_value_p);
+void ecma_shape_free_properties (ecma_object_t *object_p);
+
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_SHAPE_H */
@@ -698,11 +698,11 @@ ecma_builtin_helper_string_find_index (ecma_string_t *original_str_p, /**< index
 
       ecma_length_t index = start_pos;
 
-      const lit_utf8_byte_t *original_str_curr_p = original_str_utf8_p;
-      for (ecma_length_t idx = 0; idx < index; idx++)
-      {
-        lit_utf8_incr (&original_str_curr_p);
-      }
+      lit_utf8_size_t start_offset = ecma_string_index_to_offset (original_str_p,
+                                                                  original_str_utf8_p,
+                                                                  original_str_size,
+                                                                  index);
+      const lit_utf8_byte_t *original_str_curr_p = original_str_utf8_p + start_offset;
 
       /* create utf8 string from search string */
       ECMA_STRING_TO_UTF8_STRING (search_str_p, search_str_utf8_p, search_str_size);
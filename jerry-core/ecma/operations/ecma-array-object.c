@@ -258,6 +258,7 @@ ecma_fast_array_set_property (ecma_object_t *object_p, /**< fast access mode arr
       ecma_free_value_if_not_object (values_p[index]);
     }
 
+    ECMA_GC_WRITE_BARRIER (object_p, value);
     values_p[index] = ecma_copy_value_if_not_object (value);
 
     return true;
@@ -296,6 +297,7 @@ ecma_fast_array_set_property (ecma_object_t *object_p, /**< fast access mode arr
     ext_obj_p->u.array.u.hole_count -= ECMA_FAST_ARRAY_HOLE_ONE;
   }
 
+  ECMA_GC_WRITE_BARRIER (object_p, value);
   values_p[index] = ecma_copy_value_if_not_object (value);
 
   return true;
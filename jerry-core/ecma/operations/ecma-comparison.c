@@ -45,6 +45,14 @@ ecma_op_abstract_equality_compare (ecma_value_t x, /**< first operand */
 {
   if (x == y)
   {
+#if ENABLED (JERRY_DIRECT_FLOAT)
+    /* Equal direct float values hold the same number, which is not equal to itself if it is NaN. */
+    if (ecma_is_value_direct_float (x))
+    {
+      return ecma_make_boolean_value (!ecma_number_is_nan (ecma_get_float_from_value (x)));
+    }
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
+
     return ECMA_VALUE_TRUE;
   }
 
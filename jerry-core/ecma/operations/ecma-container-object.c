@@ -786,6 +786,9 @@ ecma_op_container_set (ecma_value_t this_arg, /**< this argument */
   }
 #endif /* ENABLED (JERRY_ES2015_BUILTIN_WEAKMAP) ||  ENABLED (JERRY_ES2015_BUILTIN_WEAKSET) */
 
+  ECMA_GC_WRITE_BARRIER ((ecma_object_t *) map_object_p, key_arg);
+  ECMA_GC_WRITE_BARRIER ((ecma_object_t *) map_object_p, value_arg);
+
   ecma_value_t *entry_p = ecma_op_internal_buffer_find (container_p, key_arg, lit_id);
 
   if (entry_p == NULL)
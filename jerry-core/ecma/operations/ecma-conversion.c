@@ -87,6 +87,15 @@ ecma_op_same_value (ecma_value_t x, /**< ecma value */
 
   ecma_type_t type_of_x = ecma_get_value_type_field (x);
 
+#if ENABLED (JERRY_DIRECT_FLOAT)
+  /* A direct and an allocated float number have different types, but they can
+   * still be the same value when both are NaN with different payloads. */
+  if (ecma_is_value_float_number (x) && ecma_is_value_float_number (y))
+  {
+    type_of_x = ecma_get_value_type_field (y);
+  }
+#endif /* ENABLED (JERRY_DIRECT_FLOAT) */
+
   if (type_of_x != ecma_get_value_type_field (y)
       || type_of_x == ECMA_TYPE_DIRECT)
   {
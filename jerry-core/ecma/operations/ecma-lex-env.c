@@ -430,6 +430,7 @@ ecma_op_create_immutable_binding (ecma_object_t *lex_env_p, /**< lexical environ
                                                                          ECMA_PROPERTY_FIXED,
                                                                          NULL);
 
+  ECMA_GC_WRITE_BARRIER (lex_env_p, value);
   prop_value_p->value = ecma_copy_value_if_not_object (value);
 } /* ecma_op_create_immutable_binding */
 
@@ -455,6 +456,7 @@ ecma_op_initialize_binding (ecma_object_t *lex_env_p, /**< lexical environment *
   ecma_property_value_t *prop_value_p = ECMA_PROPERTY_VALUE_PTR (prop_p);
   JERRY_ASSERT (prop_value_p->value == ECMA_VALUE_UNINITIALIZED);
 
+  ECMA_GC_WRITE_BARRIER (lex_env_p, value);
   prop_value_p->value = ecma_copy_value_if_not_object (value);
 } /* ecma_op_initialize_binding */
 
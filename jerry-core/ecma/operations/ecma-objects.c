@@ -21,12 +21,14 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-function-object.h"
+#include "ecma-icache.h"
 #include "ecma-lex-env.h"
 #include "ecma-string-object.h"
 #include "ecma-objects-arguments.h"
 #include "ecma-objects-general.h"
 #include "ecma-objects.h"
 #include "ecma-proxy-object.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 
 #if ENABLED (JERRY_ES2015_BUILTIN_TYPEDARRAY)
@@ -1222,6 +1224,7 @@ ecma_op_object_put_apply_receiver (ecma_value_t receiver, /**< receiver */
                                                       ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
                                                       NULL);
   JERRY_ASSERT (ecma_is_value_undefined (new_prop_value_p->value));
+  ECMA_GC_WRITE_BARRIER (receiver_obj_p, value);
   new_prop_value_p->value = ecma_copy_value_if_not_object (value);
 
   return ECMA_VALUE_TRUE;
@@ -1596,6 +1599,7 @@ ecma_op_object_put_with_receiver (ecma_object_t *object_p, /**< the object */
                                                           NULL);
 
       JERRY_ASSERT (ecma_is_value_undefined (new_prop_value_p->value));
+      ECMA_GC_WRITE_BARRIER (object_p, value);
       new_prop_value_p->value = ecma_copy_value_if_not_object (value);
       return ECMA_VALUE_TRUE;
     }
@@ -2336,10 +2340,47 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
       }
   #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
-      while (prop_iter_cp != JMEM_CP_NULL)
+#if ENABLED (JERRY_OBJECT_SHAPES)
+      ecma_property_header_t *slots_p = NULL;
+      ecma_shape_t *shape_p = NULL;
+      uint32_t slot_pair_index = 0;
+
+      if (ecma_object_has_shape (obj_p))
       {
-        ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
-        JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+        slots_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+        shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->next_property_cp);
+        slot_pair_index = ECMA_SHAPE_GET_SLOT_PAIR_COUNT (shape_p->property_count);
+        prop_iter_cp = JMEM_CP_NULL;
+      }
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+      while (true)
+      {
+        ecma_property_header_t *prop_iter_p;
+        const jmem_cpointer_t *names_cp;
+
+#if ENABLED (JERRY_OBJECT_SHAPES)
+        if (slot_pair_index > 0)
+        {
+          /* The slot pairs are visited in the same order as the property pairs. */
+          slot_pair_index--;
+          prop_iter_p = &ECMA_SHAPE_GET_SLOT_PAIRS (slots_p)[slot_pair_index].header;
+          names_cp = ECMA_SHAPE_GET_NAMES (shape_p) + slot_pair_index * 2;
+        }
+        else
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+        {
+          if (prop_iter_cp == JMEM_CP_NULL)
+          {
+            break;
+          }
+
+          prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+          JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+          names_cp = ((ecma_property_pair_t *) prop_iter_p)->names_cp;
+          prop_iter_cp = prop_iter_p->next_property_cp;
+        }
 
         for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
         {
@@ -2348,18 +2389,15 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
           if (ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
               || ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR)
           {
-            ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
-
             if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == ECMA_DIRECT_STRING_MAGIC
-                && prop_pair_p->names_cp[i] >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
-                && prop_pair_p->names_cp[i] < LIT_MAGIC_STRING__COUNT)
+                && names_cp[i] >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
+                && names_cp[i] < LIT_MAGIC_STRING__COUNT)
             {
               /* Internal properties are never enumerated. */
               continue;
             }
 
-            ecma_string_t *name_p = ecma_string_from_property_name (*property_p,
-                                                                    prop_pair_p->names_cp[i]);
+            ecma_string_t *name_p = ecma_string_from_property_name (*property_p, names_cp[i]);
 
             if (!(is_enumerable_only && !ecma_is_property_enumerable (*property_p)))
             {
@@ -2444,8 +2482,6 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
             }
           }
         }
-
-        prop_iter_cp = prop_iter_p->next_property_cp;
       }
     }
 
@@ -3169,8 +3205,17 @@ ecma_op_ordinary_object_set_prototype_of (ecma_object_t *obj_p, /**< base object
   }
 
   /* 9. */
+  if (new_proto_p != NULL)
+  {
+    ECMA_GC_WRITE_BARRIER (obj_p, ecma_make_object_value (new_proto_p));
+  }
+
   ECMA_SET_POINTER (obj_p->u2.prototype_cp, new_proto_p);
 
+#if ENABLED (JERRY_INLINE_CACHE)
+  ecma_icache_invalidate_all ();
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
   /* 10. */
   return ECMA_VALUE_TRUE;
 } /* ecma_op_ordinary_object_set_prototype_of */
@@ -76,6 +76,7 @@ ecma_promise_set_result (ecma_object_t *obj_p, /**< points to promise object */
 
   JERRY_ASSERT (ext_object_p->u.class_prop.u.value == ECMA_VALUE_UNDEFINED);
 
+  ECMA_GC_WRITE_BARRIER (obj_p, result);
   ext_object_p->u.class_prop.u.value = result;
 } /* ecma_promise_set_result */
 
@@ -888,6 +889,10 @@ ecma_promise_do_then (ecma_value_t promise, /**< the promise which call 'then' *
       ECMA_SET_SECOND_BIT_TO_POINTER_TAG (capability_with_tag);
     }
 
+    ECMA_GC_WRITE_BARRIER (promise_obj_p, result_capability);
+    ECMA_GC_WRITE_BARRIER (promise_obj_p, on_fulfilled);
+    ECMA_GC_WRITE_BARRIER (promise_obj_p, on_rejected);
+
     ecma_collection_push_back (promise_p->reactions, capability_with_tag);
 
     if (on_fulfilled != ECMA_VALUE_TRUE)
@@ -1742,10 +1742,7 @@ ecma_regexp_exec_helper (ecma_object_t *regexp_object_p, /**< RegExp object */
       }
       else
       {
-        for (uint32_t i = 0; i < index; i++)
-        {
-          lit_utf8_incr (&input_curr_p);
-        }
+        input_curr_p += ecma_string_index_to_offset (input_string_p, input_buffer_p, input_size, index);
       }
     }
   }
@@ -10,6 +10,7 @@
 #include "ecma-conversion.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "ecma-shape.h"
 #include "vm.h"
 
 void PrintObjectValueProperties(ecma_value_t value)
@@ -23,6 +24,12 @@ void PrintObjectValueProperties(ecma_value_t value)
 
 void PrintObjectProperties(ecma_object_t* object)
 {
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ecma_object_has_shape(object)) {
+    ecma_shape_convert_to_normal(object, NULL);
+  }
+#endif
+
   jmem_cpointer_t prop_iter_cp = object->u1.property_list_cp;
 
   while (prop_iter_cp != JMEM_CP_NULL) {
@@ -12,6 +12,7 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-property-hashmap.h"
+#include "ecma-shape.h"
 #include "ecma-array-object.h"
 
 #include <stdio.h>
@@ -173,9 +174,10 @@ void DumpInfoFunction(const ecma_object_t* object)
   }
 }
 
-void DumpPropertyPair(ecma_property_pair_t* pair)
+static void DumpProperties(ecma_property_header_t* header,
+                           ecma_property_value_t* values,
+                           const jmem_cpointer_t* names_cp)
 {
-  ecma_property_header_t* header = (ecma_property_header_t*)pair;
   for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++) {
     Start();
 
@@ -185,13 +187,13 @@ void DumpPropertyPair(ecma_property_pair_t* pair)
 
         Key("key");
         ecma_string_t* key_str = ecma_string_from_property_name(header->types[i],
-                                                                pair->names_cp[i]);
+                                                                names_cp[i]);
         LogStrObj(key_str);
         ecma_deref_ecma_string(key_str);
         Next();
 
         Key("value");
-        ecma_value_t value = pair->values[i].value;
+        ecma_value_t value = values[i].value;
         if (ecma_is_value_object(value)) {
           ecma_object_t* value_obj = ecma_get_object_from_value(value);
           LogAddr(value_obj);
@@ -204,7 +206,7 @@ void DumpPropertyPair(ecma_property_pair_t* pair)
       case ECMA_PROPERTY_TYPE_NAMEDACCESSOR: {
         Type("accessor");
 
-        ecma_property_value_t* accessor_objs_p = pair->values + i;
+        ecma_property_value_t* accessor_objs_p = values + i;
         ecma_getter_setter_pointers_t* get_set_pair_p =
             ecma_get_named_accessor_property(accessor_objs_p);
 
@@ -241,6 +243,11 @@ void DumpPropertyPair(ecma_property_pair_t* pair)
   }
 }
 
+void DumpPropertyPair(ecma_property_pair_t* pair)
+{
+  DumpProperties(&pair->header, pair->values, pair->names_cp);
+}
+
 void DumpInfoObject(ecma_object_t* object, heapdump_object_flags_t flags)
 {
   Start();
@@ -370,6 +377,26 @@ void DumpInfoObject(ecma_object_t* object, heapdump_object_flags_t flags)
 
   Key("properties");
   StartList();
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  if (ecma_object_has_shape(object)) {
+    ecma_property_header_t* slots_p =
+        ECMA_GET_NON_NULL_POINTER(ecma_property_header_t, prop_iter_cp);
+    ecma_shape_t* shape_p = ECMA_GET_NON_NULL_POINTER(ecma_shape_t, slots_p->next_property_cp);
+    ecma_shape_slot_pair_t* slot_pairs_p = ECMA_SHAPE_GET_SLOT_PAIRS(slots_p);
+    uint32_t slot_pair_count = ECMA_SHAPE_GET_SLOT_PAIR_COUNT(shape_p->property_count);
+
+    /* Newest properties first, like in the property pair list. */
+    for (uint32_t i = slot_pair_count; i > 0; i--) {
+      DumpProperties(&slot_pairs_p[i - 1].header,
+                     slot_pairs_p[i - 1].values,
+                     ECMA_SHAPE_GET_NAMES(shape_p) + (i - 1) * 2);
+      if (i > 1) {
+        Next();
+      }
+    }
+    prop_iter_cp = JMEM_CP_NULL;
+  }
+#endif
   while (prop_iter_cp != JMEM_CP_NULL) {
     ecma_property_header_t* prop_iter_p =
         ECMA_GET_NON_NULL_POINTER(ecma_property_header_t, prop_iter_cp);
@@ -104,6 +104,10 @@ typedef enum
   JERRY_FEATURE_SET, /**< Set support */
   JERRY_FEATURE_WEAKMAP, /**< WeakMap support */
   JERRY_FEATURE_WEAKSET, /**< WeakSet support */
+  JERRY_FEATURE_GC_INCREMENTAL, /**< incremental garbage collection support */
+  JERRY_FEATURE_GC_GENERATIONAL, /**< generational garbage collection support */
+  JERRY_FEATURE_GC_LAZY_SWEEP, /**< lazy sweeping support */
+  JERRY_FEATURE_VM_PROFILER, /**< sampling profiler */
   JERRY_FEATURE__COUNT /**< number of features. NOTE: must be at the end of the list */
 } jerry_feature_t;
 
@@ -201,6 +205,7 @@ typedef struct
 
 /**
  * Description of JerryScript heap memory stats.
+ * The size of the struct must not change, since it is allocated by the caller.
  * It is for memory profiling.
  */
 typedef struct
@@ -209,9 +214,61 @@ typedef struct
   size_t size; /**< heap total size */
   size_t allocated_bytes; /**< currently allocated bytes */
   size_t peak_allocated_bytes; /**< peak allocated bytes */
-  size_t reserved[4]; /**< padding for future extensions */
+  size_t free_region_bytes; /**< total size of the free heap regions (since version 2) */
+  size_t largest_free_region; /**< size of the largest free heap region (since version 2) */
+  size_t size_class_bytes; /**< total size of the freed blocks kept for reuse
+                            *   by allocations of the same size (since version 2) */
+  size_t reserved[1]; /**< padding for future extensions */
 } jerry_heap_stats_t;
 
+/**
+ * Number of allocation size classes of the garbage collector telemetry.
+ */
+#define JERRY_GC_TELEMETRY_SIZE_CLASS_COUNT 16
+
+/**
+ * Number of buckets of the garbage collector pause histogram.
+ */
+#define JERRY_GC_PAUSE_HISTOGRAM_SIZE 8
+
+/**
+ * Description of the garbage collector and allocator telemetry of a context.
+ * The counters are maintained in every build, and never reset.
+ */
+typedef struct
+{
+  size_t version; /**< the version of the telemetry struct */
+  size_t gc_count; /**< number of finished garbage collection cycles */
+  size_t gc_pause_count; /**< number of garbage collector pauses */
+  size_t gc_pause_total_us; /**< total length of the garbage collector pauses in microseconds */
+  size_t gc_pause_max_us; /**< length of the longest garbage collector pause in microseconds */
+  size_t gc_pause_histogram[JERRY_GC_PAUSE_HISTOGRAM_SIZE]; /**< number of garbage collector pauses,
+                                                              *   the upper bound of bucket i is
+                                                              *   250 * 2^i microseconds */
+  size_t gc_marked_objects; /**< number of objects kept alive by the last collection cycle */
+  size_t gc_swept_objects; /**< number of unreachable objects found by the last collection cycle */
+  size_t gc_marked_objects_total; /**< number of objects kept alive by all collection cycles */
+  size_t gc_swept_objects_total; /**< number of unreachable objects found by all collection cycles */
+  size_t alloc_count[JERRY_GC_TELEMETRY_SIZE_CLASS_COUNT]; /**< number of heap allocations, bucket i counts
+                                                             *   the blocks of 8 * (i + 1) bytes, the last
+                                                             *   bucket counts the larger blocks as well */
+  size_t first_fit_count; /**< number of allocations which searched the free region list */
+  size_t first_fit_steps; /**< total number of free regions visited by these searches */
+  size_t first_fit_max_steps; /**< number of free regions visited by the longest search */
+  size_t reserved[2]; /**< padding for future extensions */
+} jerry_gc_telemetry_t;
+
+/**
+ * Description of the inline cache counters of a context.
+ */
+typedef struct
+{
+  size_t version; /**< the version of the stats struct */
+  size_t hits; /**< number of property accesses served by the inline caches */
+  size_t misses; /**< number of property accesses of objects with shapes which missed the inline caches */
+  size_t reserved[2]; /**< padding for future extensions */
+} jerry_inline_cache_stats_t;
+
 /**
  * Type of an external function handler.
  */
@@ -238,6 +295,27 @@ typedef void (*jerry_object_native_free_callback_t) (void *native_p);
  */
 typedef jerry_value_t (*jerry_vm_exec_stop_callback_t) (void *user_p);
 
+/**
+ * Description of a call stack frame of a profiler sample.
+ */
+typedef struct
+{
+  const void *function_p; /**< identifier of the byte code executed by the frame */
+  jerry_value_t resource_name; /**< resource name of the byte code (undefined if it is not available) */
+  uint32_t line; /**< currently executed line (0 if it is not available) */
+  uint32_t byte_offset; /**< offset of the currently executed byte code instruction */
+} jerry_vm_profile_frame_t;
+
+/**
+ * Callback which receives the samples of the profiler.
+ *
+ * The frames are ordered from the outermost to the innermost one, and they are
+ * only valid during the call. The callback must not execute ECMAScript code.
+ */
+typedef void (*jerry_vm_profile_callback_t) (const jerry_vm_profile_frame_t *frames_p,
+                                             uint32_t frame_count,
+                                             void *user_p);
+
 /**
  * Function type applied for each data property of an object.
  */
@@ -354,9 +432,13 @@ void jerry_register_magic_strings (const jerry_char_t * const *ex_str_items_p,
                                    uint32_t count,
                                    const jerry_length_t *str_lengths_p);
 void jerry_gc (jerry_gc_mode_t mode);
+bool jerry_gc_step (uint32_t budget_us);
+bool jerry_gc_sweep_step (uint32_t budget_us);
 void *jerry_get_context_data (const jerry_context_data_manager_t *manager_p);
 
 bool jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p);
+bool jerry_get_gc_telemetry (jerry_gc_telemetry_t *out_telemetry_p);
+bool jerry_get_inline_cache_stats (jerry_inline_cache_stats_t *out_stats_p);
 
 /**
  * Parser and executor functions.
@@ -617,6 +699,7 @@ jerry_context_t *jerry_create_context (uint32_t heap_size, jerry_context_alloc_t
  * Miscellaneous functions.
  */
 void jerry_set_vm_exec_stop_callback (jerry_vm_exec_stop_callback_t stop_cb, void *user_p, uint32_t frequency);
+void jerry_set_vm_profile_callback (jerry_vm_profile_callback_t profile_cb, void *user_p, uint32_t frequency);
 jerry_value_t jerry_get_backtrace (uint32_t max_depth);
 jerry_value_t jerry_get_resource_name (const jerry_value_t value);
 jerry_value_t jerry_get_new_target (void);
@@ -181,6 +181,35 @@ struct jerry_context_t *jerry_port_get_current_context (void);
  */
 void jerry_port_sleep (uint32_t sleep_time);
 
+/**
+ * Task run by the workers of jerry_port_run_parallel.
+ *
+ * @param data_p the data pointer passed to jerry_port_run_parallel.
+ * @param worker_index index of the worker, between 0 and worker_count - 1.
+ */
+typedef void (*jerry_port_parallel_task_t) (void *data_p, uint32_t worker_index);
+
+/**
+ * Run a task by several workers in parallel, and wait until all of them return.
+ *
+ * Note:
+ *      This port function is called by jerry-core when JERRY_GC_PARALLEL_MARK
+ *      is enabled (set to 1). Otherwise this function is not used.
+ *
+ *      The engine is stopped while the task runs. When JERRY_EXTERNAL_CONTEXT
+ *      is enabled, jerry_port_get_current_context must return the context of
+ *      the calling thread on the worker threads as well.
+ *
+ *      The calling thread may run one of the workers. When the port cannot
+ *      start some or all of the workers (e.g. there are no threads), the
+ *      engine finishes their work on the calling thread.
+ *
+ * @param task_p the task to run.
+ * @param data_p data pointer passed to the task.
+ * @param worker_count number of workers.
+ */
+void jerry_port_run_parallel (jerry_port_parallel_task_t task_p, void *data_p, uint32_t worker_count);
+
 /**
  * Print a single character.
  *
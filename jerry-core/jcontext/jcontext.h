@@ -69,6 +69,17 @@
 #define CONFIG_GC_LIMIT (JERRY_MIN (CONFIG_MEM_HEAP_SIZE / 32, CONFIG_MAX_GC_LIMIT))
 #endif
 
+/**
+ * Current step of the heap usage limit
+ *
+ * The adaptive garbage collection trigger recomputes the step after each garbage collection.
+ */
+#if ENABLED (JERRY_GC_ADAPTIVE_LIMIT)
+#define JMEM_HEAP_GC_STEP (JERRY_CONTEXT (jmem_heap_gc_step))
+#else /* !ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
+#define JMEM_HEAP_GC_STEP CONFIG_GC_LIMIT
+#endif /* ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
+
 /**
  * Amount of newly allocated objects since the last GC run, represented as a fraction of all allocated objects,
  * which when reached will trigger garbage collection to run with a low pressure setting.
@@ -134,6 +145,14 @@ struct jerry_context_t
 #endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
   jmem_cpointer_t ecma_gc_objects_cp; /**< List of currently alive objects. */
   jmem_heap_free_t *jmem_heap_list_skip_p; /**< This is used to speed up deallocation. */
+#if ENABLED (JERRY_MEM_SIZE_CLASSES) && !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+  uint32_t jmem_heap_size_class_offsets[JMEM_HEAP_SIZE_CLASS_COUNT]; /**< first free block of each size class */
+  size_t jmem_heap_size_class_bytes; /**< total size of the blocks on the size class free lists */
+#endif /* ENABLED (JERRY_MEM_SIZE_CLASSES) && !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+#if ENABLED (JERRY_MEM_SLAB_ALLOCATOR) && !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+  jmem_heap_slab_t *jmem_heap_slab_lists[JMEM_HEAP_SLAB_CLASS_COUNT]; /**< slabs with free slots for each slot size */
+  uint32_t *jmem_heap_slab_pages_p; /**< a bit is set for each slab sized part of the heap used by a slab */
+#endif /* ENABLED (JERRY_MEM_SLAB_ALLOCATOR) && !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
   jmem_pools_chunk_t *jmem_free_8_byte_chunk_p; /**< list of free eight byte pool chunks */
 #if ENABLED (JERRY_CPOINTER_32_BIT)
   jmem_pools_chunk_t *jmem_free_16_byte_chunk_p; /**< list of free sixteen byte pool chunks */
@@ -145,6 +164,10 @@ struct jerry_context_t
   jmem_cpointer_t symbol_list_first_cp; /**< first item of the global symbol list */
 #endif /* ENABLED (JERRY_ES2015) */
   jmem_cpointer_t number_list_first_cp; /**< first item of the literal number list */
+#if ENABLED (JERRY_LIT_HASH_TABLE)
+  ecma_lit_hash_table_t lit_string_table; /**< hash table of the literal strings */
+  ecma_lit_hash_table_t lit_number_table; /**< hash table of the literal numbers */
+#endif /* ENABLED (JERRY_LIT_HASH_TABLE) */
   jmem_cpointer_t ecma_global_env_cp; /**< global lexical environment */
 #if ENABLED (JERRY_ES2015)
   jmem_cpointer_t ecma_global_scope_cp; /**< global lexical scope */
@@ -162,23 +185,68 @@ struct jerry_context_t
   size_t jmem_heap_allocated_size; /**< size of allocated regions */
   size_t jmem_heap_limit; /**< current limit of heap usage, that is upon being reached,
                            *   causes call of "try give memory back" callbacks */
+#if ENABLED (JERRY_GC_ADAPTIVE_LIMIT)
+  size_t jmem_heap_gc_step; /**< heap usage increase allowed until the next garbage collection */
+  size_t ecma_gc_policy_live_size; /**< estimated size of the live heap after the last garbage collection */
+  double ecma_gc_policy_last_time; /**< end time of the last garbage collection */
+#endif /* ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
+  jmem_telemetry_t jmem_telemetry; /**< garbage collector and allocator counters */
   ecma_value_t error_value; /**< currently thrown error value */
   uint32_t lit_magic_string_ex_count; /**< external magic strings count */
   uint32_t jerry_init_flags; /**< run-time configuration flags */
   uint32_t status_flags; /**< run-time flags (the top 8 bits are used for passing class parsing options) */
 #if (JERRY_GC_MARK_LIMIT != 0)
-  uint32_t ecma_gc_mark_recursion_limit; /**< GC mark recursion limit */
+  uint32_t ecma_gc_mark_stack_top; /**< number of objects on the GC gray object worklist */
+  jmem_cpointer_t ecma_gc_mark_stack[JERRY_GC_MARK_LIMIT]; /**< GC gray object worklist */
 #endif /* (JERRY_GC_MARK_LIMIT != 0) */
+#if ENABLED (JERRY_GC_INCREMENTAL)
+  jmem_cpointer_t *ecma_gc_incremental_stack_p; /**< gray object worklist of the incremental collector */
+  uint32_t ecma_gc_incremental_stack_size; /**< capacity of the incremental gray object worklist */
+  uint32_t ecma_gc_incremental_stack_top; /**< number of objects on the incremental gray object worklist */
+  size_t ecma_gc_incremental_marked; /**< number of live objects found by the sweep of the current cycle */
+  size_t ecma_gc_incremental_swept; /**< number of objects freed by the sweep of the current cycle */
+  jmem_cpointer_t ecma_gc_sweep_objects_cp; /**< list of objects which are not swept yet */
+  uint8_t ecma_gc_incremental_state; /**< current phase of the incremental collector (ecma_gc_incremental_state_t) */
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+  jmem_cpointer_t ecma_gc_lazy_sweep_cp; /**< list of unreachable objects which are not freed yet */
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
+#if ENABLED (JERRY_GC_GENERATIONAL)
+  uint32_t *ecma_gc_young_bitmap_p; /**< one bit for each heap unit: set for the first unit of young objects */
+  uint32_t *ecma_gc_remembered_bitmap_p; /**< one bit for each heap unit: set for the first unit of
+                                          *   old objects which may refer to young objects */
+  jmem_cpointer_t ecma_gc_old_objects_cp; /**< first old object of the object list: the objects
+                                           *   before it are young */
+  size_t ecma_gc_promoted_objects; /**< number of objects promoted to the old generation since last full GC */
+#endif /* ENABLED (JERRY_GC_GENERATIONAL) */
 
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
   uint8_t ecma_prop_hashmap_alloc_state; /**< property hashmap allocation state: 0-4,
                                           *   if !0 property hashmap allocation is disabled */
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
+#if ENABLED (JERRY_OBJECT_SHAPES)
+  jmem_cpointer_t ecma_shape_roots_cp; /**< first level shapes of the shape transition tree */
+  uint32_t ecma_shape_count; /**< number of shapes */
+#endif /* ENABLED (JERRY_OBJECT_SHAPES) */
+
+#if ENABLED (JERRY_INLINE_CACHE)
+  size_t ecma_icache_hits; /**< number of property accesses served by the inline caches */
+  size_t ecma_icache_misses; /**< number of property accesses of objects with shapes
+                              *   which are not found in the inline caches */
+  bool ecma_icache_is_used; /**< the inline caches may have entries */
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
 #if ENABLED (JERRY_BUILTIN_REGEXP)
   uint8_t re_cache_idx; /**< evicted item index when regex cache is full (round-robin) */
 #endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
 
+#if ENABLED (JERRY_STRING_INDEX)
+  ecma_string_index_t ecma_string_index_cache[ECMA_STRING_INDEX_CACHE_SIZE]; /**< index tables of the recently
+                                                                             *   accessed non-ASCII strings */
+  uint8_t ecma_string_index_cache_idx; /**< evicted item index when the string index cache is full (round-robin) */
+#endif /* ENABLED (JERRY_STRING_INDEX) */
+
 #if ENABLED (JERRY_ES2015_BUILTIN_PROMISE)
   ecma_job_queue_item_t *job_queue_head_p; /**< points to the head item of the job queue */
   ecma_job_queue_item_t *job_queue_tail_p; /**< points to the tail item of the job queue */
@@ -192,6 +260,17 @@ struct jerry_context_t
                                                  *   ECMAScript execution should be stopped */
 #endif /* ENABLED (JERRY_VM_EXEC_STOP) */
 
+#if ENABLED (JERRY_VM_PROFILER)
+  uint32_t vm_profile_frequency; /**< reset value for vm_profile_counter */
+  uint32_t vm_profile_counter; /**< down counter of the events until the next sample */
+  void *vm_profile_user_p; /**< user pointer for vm_profile_cb */
+  jerry_vm_profile_callback_t vm_profile_cb; /**< user function which receives the samples */
+#endif /* ENABLED (JERRY_VM_PROFILER) */
+
+#if (JERRY_VM_STACK_SIZE != 0)
+  size_t vm_stack_top; /**< number of words of the VM stack used by the frames of the running functions */
+#endif /* (JERRY_VM_STACK_SIZE != 0) */
+
 #if (JERRY_STACK_LIMIT != 0)
   uintptr_t stack_base;  /**< stack base marker */
 #endif /* (JERRY_STACK_LIMIT != 0) */
@@ -221,12 +300,23 @@ struct jerry_context_t
   jmem_heap_stats_t jmem_heap_stats; /**< heap's memory usage statistics */
 #endif /* ENABLED (JERRY_MEM_STATS) */
 
+#if ENABLED (JERRY_GC_PARALLEL_MARK)
+  uint32_t ecma_gc_mark_active_workers; /**< number of parallel marking workers which may produce gray objects */
+  ecma_gc_mark_deque_t ecma_gc_mark_deques[JERRY_GC_MARK_THREADS]; /**< gray object deques of the parallel
+                                                                    *   marking workers */
+#endif /* ENABLED (JERRY_GC_PARALLEL_MARK) */
+
   /* This must be at the end of the context for performance reasons */
 #if ENABLED (JERRY_LCACHE)
   /** hash table for caching the last access of properties */
   ecma_lcache_hash_entry_t lcache[ECMA_LCACHE_HASH_ROWS_COUNT][ECMA_LCACHE_HASH_ROW_LENGTH];
 #endif /* ENABLED (JERRY_LCACHE) */
 
+#if ENABLED (JERRY_INLINE_CACHE)
+  /** inline caches of the property access instructions */
+  ecma_icache_entry_t icache[ECMA_ICACHE_ROWS_COUNT][ECMA_ICACHE_ROW_LENGTH];
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
 #if ENABLED (JERRY_ES2015)
   /**
    * Allowed values and it's meaning:
@@ -243,6 +333,11 @@ struct jerry_context_t
   fatal_handler_t jerry_fatal_handler; /* js task fatal handler */
 #endif  /* ENABLED (JERRY_EXTERNAL_CONTEXT) */
 #endif // not defined JERRY_FOR_IAR_CONFIG
+
+#if (JERRY_VM_STACK_SIZE != 0)
+  /** frames of the running functions (the last member, so it does not move the other members away) */
+  uintptr_t vm_stack[VM_STACK_WORD_COUNT];
+#endif /* (JERRY_VM_STACK_SIZE != 0) */
 };
 
 #if ENABLED (JERRY_EXTERNAL_CONTEXT)
@@ -141,8 +141,68 @@ jmem_stats_free_property_bytes (size_t property_size)
   heap_stats->property_bytes -= property_size;
 } /* jmem_stats_free_property_bytes */
 
+/**
+ * Register garbage collector pause.
+ */
+void
+jmem_stats_gc_pause (double pause_ms) /**< length of the pause in milliseconds */
+{
+  jmem_heap_stats_t *heap_stats = &JERRY_CONTEXT (jmem_heap_stats);
+
+  heap_stats->gc_pause_total_us += (size_t) (pause_ms * 1000.0);
+} /* jmem_stats_gc_pause */
+
 #endif /* ENABLED (JERRY_MEM_STATS) */
 
+/**
+ * Register garbage collector pause.
+ */
+void
+jmem_telemetry_gc_pause (double pause_ms) /**< length of the pause in milliseconds */
+{
+  jmem_telemetry_t *telemetry_p = &JERRY_CONTEXT (jmem_telemetry);
+  size_t pause_us = (size_t) (pause_ms * 1000.0);
+
+  telemetry_p->gc_pause_count++;
+  telemetry_p->gc_pause_total_us += pause_us;
+
+  if (pause_us > telemetry_p->gc_pause_max_us)
+  {
+    telemetry_p->gc_pause_max_us = pause_us;
+  }
+
+  uint32_t bucket = 0;
+  double bound_ms = 0.25;
+
+  while (bucket < JMEM_GC_PAUSE_HISTOGRAM_SIZE - 1 && pause_ms >= bound_ms)
+  {
+    bucket++;
+    bound_ms *= 2;
+  }
+
+  telemetry_p->gc_pause_histogram[bucket]++;
+
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_gc_pause (pause_ms);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+} /* jmem_telemetry_gc_pause */
+
+/**
+ * Register finished garbage collection cycle.
+ */
+void
+jmem_telemetry_gc_cycle (size_t marked_objects, /**< number of objects kept alive */
+                         size_t swept_objects) /**< number of unreachable objects */
+{
+  jmem_telemetry_t *telemetry_p = &JERRY_CONTEXT (jmem_telemetry);
+
+  telemetry_p->gc_count++;
+  telemetry_p->gc_marked_objects = marked_objects;
+  telemetry_p->gc_swept_objects = swept_objects;
+  telemetry_p->gc_marked_objects_total += marked_objects;
+  telemetry_p->gc_swept_objects_total += swept_objects;
+} /* jmem_telemetry_gc_cycle */
+
 /**
  * Initialize memory allocators.
  */
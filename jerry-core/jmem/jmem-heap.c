@@ -23,17 +23,6 @@
 #include "jrt-bit-fields.h"
 #include "jrt-libc-includes.h"
 
-void *JerryHeapMalloc(uint32_t size)
-{
-   return NULL;
-}
-bool JerryHeapFree(void *addr)
-{
-   return false;
-}
-
-void JerryHeapInit() {}
-
 #define JMEM_ALLOCATOR_INTERNAL
 #include "jmem-allocator-internal.h"
 
@@ -88,6 +77,20 @@ jmem_heap_get_region_end (jmem_heap_free_t *curr_p) /**< current region */
 {
   return (jmem_heap_free_t *) ((uint8_t *) curr_p + curr_p->size);
 } /* jmem_heap_get_region_end */
+
+#if ENABLED (JERRY_MEM_SIZE_CLASSES)
+/**
+ * Check whether an aligned block size has a size class free list.
+ */
+#define JMEM_HEAP_IS_SIZE_CLASS(size) \
+  ((size) >= JMEM_HEAP_SIZE_CLASS_MIN && (size) <= JMEM_HEAP_SIZE_CLASS_MAX)
+
+/**
+ * Get the free list head of the size class of an aligned block size.
+ */
+#define JMEM_HEAP_SIZE_CLASS_HEAD(size) \
+  (JERRY_CONTEXT (jmem_heap_size_class_offsets)[((size) - JMEM_HEAP_SIZE_CLASS_MIN) >> JMEM_ALIGNMENT_LOG])
+#endif /* ENABLED (JERRY_MEM_SIZE_CLASSES) */
 #endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
 
 /**
@@ -96,6 +99,11 @@ jmem_heap_get_region_end (jmem_heap_free_t *curr_p) /**< current region */
 void
 jmem_heap_init (void)
 {
+#if ENABLED (JERRY_GC_ADAPTIVE_LIMIT)
+  /* The policy has no measurements before the first garbage collection. */
+  JERRY_CONTEXT (jmem_heap_gc_step) = CONFIG_GC_LIMIT;
+#endif /* ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
+
 #if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
 #if !ENABLED (JERRY_CPOINTER_32_BIT)
   /* the maximum heap size for 16bit compressed pointers should be 512K */
@@ -115,11 +123,21 @@ jmem_heap_init (void)
 
   JERRY_CONTEXT (jmem_heap_list_skip_p) = &JERRY_HEAP_CONTEXT (first);
 
+#if ENABLED (JERRY_MEM_SIZE_CLASSES)
+  for (uint32_t i = 0; i < JMEM_HEAP_SIZE_CLASS_COUNT; i++)
+  {
+    JERRY_CONTEXT (jmem_heap_size_class_offsets)[i] = JMEM_HEAP_END_OF_LIST;
+  }
+
+  JERRY_CONTEXT (jmem_heap_size_class_bytes) = 0;
+#endif /* ENABLED (JERRY_MEM_SIZE_CLASSES) */
+
   JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
   JMEM_VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (area), JMEM_HEAP_SIZE);
 
 #endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
   JMEM_HEAP_STAT_INIT ();
+  JerryHeapInit ();
 } /* jmem_heap_init */
 
 /**
@@ -128,6 +146,7 @@ jmem_heap_init (void)
 void
 jmem_heap_finalize (void)
 {
+  JerryHeapFinalize ();
   JERRY_ASSERT (JERRY_CONTEXT (jmem_heap_allocated_size) == 0);
 #if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
   JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), JMEM_HEAP_SIZE);
@@ -146,23 +165,47 @@ jmem_heap_finalize (void)
 static void * JERRY_ATTR_HOT
 jmem_heap_alloc (const size_t size) /**< size of requested block */
 {
-  if (size > 8 && size <= 24) {
-   void *data_space_p = JerryHeapMalloc (size);
-   if (data_space_p != NULL)
-   {
-     JERRY_CONTEXT (jmem_heap_allocated_size) += size;
-     while(JERRY_CONTEXT(jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
-     {
-       JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
-     }
-     return data_space_p;
-   }
+  if (size > JMEM_ALIGNMENT && size <= JMEM_HEAP_SLAB_MAX_SIZE)
+  {
+    /* The hook accounts the memory it uses in the allocated heap size. */
+    void *data_space_p = JerryHeapMalloc ((uint32_t) size);
+
+    if (data_space_p != NULL)
+    {
+      return data_space_p;
+    }
   }
 #if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
   /* Align size. */
   const size_t required_size = ((size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT) * JMEM_ALIGNMENT;
   jmem_heap_free_t *data_space_p = NULL;
 
+#if ENABLED (JERRY_MEM_SIZE_CLASSES)
+  /* Fast path for blocks which have a size class: take the first block of the size class free list. */
+  if (JMEM_HEAP_IS_SIZE_CLASS (required_size)
+      && JMEM_HEAP_SIZE_CLASS_HEAD (required_size) != JMEM_HEAP_END_OF_LIST)
+  {
+    data_space_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (JMEM_HEAP_SIZE_CLASS_HEAD (required_size));
+    JERRY_ASSERT (jmem_is_heap_pointer (data_space_p));
+
+    JMEM_VALGRIND_DEFINED_SPACE (data_space_p, sizeof (jmem_heap_free_t));
+    JERRY_ASSERT (data_space_p->size == required_size);
+    JMEM_HEAP_SIZE_CLASS_HEAD (required_size) = data_space_p->next_offset;
+    JMEM_VALGRIND_NOACCESS_SPACE (data_space_p, sizeof (jmem_heap_free_t));
+
+    JERRY_CONTEXT (jmem_heap_size_class_bytes) -= required_size;
+    JERRY_CONTEXT (jmem_heap_allocated_size) += required_size;
+
+    while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
+    {
+      JERRY_CONTEXT (jmem_heap_limit) += JMEM_HEAP_GC_STEP;
+    }
+
+    JMEM_VALGRIND_MALLOCLIKE_SPACE (data_space_p, size);
+    return (void *) data_space_p;
+  }
+#endif /* ENABLED (JERRY_MEM_SIZE_CLASSES) */
+
   JMEM_VALGRIND_DEFINED_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
 
   /* Fast path for 8 byte chunks, first region is guaranteed to be sufficient. */
@@ -177,7 +220,7 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
 
     if (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
     {
-      JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
+      JERRY_CONTEXT (jmem_heap_limit) += JMEM_HEAP_GC_STEP;
     }
 
     if (data_space_p->size == JMEM_ALIGNMENT)
@@ -211,9 +254,12 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
   {
     uint32_t current_offset = JERRY_HEAP_CONTEXT (first).next_offset;
     jmem_heap_free_t *prev_p = &JERRY_HEAP_CONTEXT (first);
+    size_t walk_steps = 0;
 
     while (JERRY_LIKELY (current_offset != JMEM_HEAP_END_OF_LIST))
     {
+      walk_steps++;
+
       jmem_heap_free_t *current_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (current_offset);
       JERRY_ASSERT (jmem_is_heap_pointer (current_p));
       JMEM_VALGRIND_DEFINED_SPACE (current_p, sizeof (jmem_heap_free_t));
@@ -260,7 +306,7 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
 
         while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
         {
-          JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
+          JERRY_CONTEXT (jmem_heap_limit) += JMEM_HEAP_GC_STEP;
         }
 
         break;
@@ -271,10 +317,29 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
       prev_p = current_p;
       current_offset = next_offset;
     }
+
+    jmem_telemetry_t *telemetry_p = &JERRY_CONTEXT (jmem_telemetry);
+    telemetry_p->first_fit_count++;
+    telemetry_p->first_fit_steps += walk_steps;
+
+    if (walk_steps > telemetry_p->first_fit_max_steps)
+    {
+      telemetry_p->first_fit_max_steps = walk_steps;
+    }
   }
 
   JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
 
+#if ENABLED (JERRY_MEM_SIZE_CLASSES)
+  if (JERRY_UNLIKELY (data_space_p == NULL)
+      && JERRY_CONTEXT (jmem_heap_size_class_bytes) > 0)
+  {
+    /* The blocks kept on the size class free lists may form a sufficiently large region. */
+    jmem_heap_collect_size_classes ();
+    return jmem_heap_alloc (size);
+  }
+#endif /* ENABLED (JERRY_MEM_SIZE_CLASSES) */
+
   JERRY_ASSERT ((uintptr_t) data_space_p % JMEM_ALIGNMENT == 0);
   JMEM_VALGRIND_MALLOCLIKE_SPACE (data_space_p, size);
 
@@ -284,7 +349,7 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
 
   while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
   {
-    JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
+    JERRY_CONTEXT (jmem_heap_limit) += JMEM_HEAP_GC_STEP;
   }
 
   return malloc (size);
@@ -312,8 +377,20 @@ jmem_heap_gc_and_alloc_block (const size_t size, /**< required memory size */
     return NULL;
   }
 
+  const size_t size_class = (size - 1) >> JMEM_ALIGNMENT_LOG;
+  JERRY_CONTEXT (jmem_telemetry).alloc_count[JERRY_MIN (size_class, JMEM_TELEMETRY_SIZE_CLASS_COUNT - 1)]++;
+
   jmem_pressure_t pressure = JMEM_PRESSURE_NONE;
 
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+  if (JERRY_CONTEXT (ecma_gc_lazy_sweep_cp) != JMEM_CP_NULL)
+  {
+    /* Each allocation frees a few objects left over by the last garbage collection,
+     * and no new collection is started until all of them are freed. */
+    ecma_gc_lazy_sweep (ECMA_GC_LAZY_SWEEP_ALLOC_COUNT);
+  }
+  else
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
 #if !ENABLED (JERRY_MEM_GC_BEFORE_EACH_ALLOC)
   if (JERRY_CONTEXT (jmem_heap_allocated_size) + size >= JERRY_CONTEXT (jmem_heap_limit))
 #endif /* !ENABLED (JERRY_MEM_GC_BEFORE_EACH_ALLOC) */
@@ -324,6 +401,15 @@ jmem_heap_gc_and_alloc_block (const size_t size, /**< required memory size */
 
   void *data_space_p = jmem_heap_alloc (size);
 
+#if ENABLED (JERRY_GC_LAZY_SWEEP)
+  if (JERRY_UNLIKELY (data_space_p == NULL) && JERRY_CONTEXT (ecma_gc_lazy_sweep_cp) != JMEM_CP_NULL)
+  {
+    /* Freeing the pending objects is cheaper than a new collection. */
+    ecma_gc_finish_lazy_sweep ();
+    data_space_p = jmem_heap_alloc (size);
+  }
+#endif /* ENABLED (JERRY_GC_LAZY_SWEEP) */
+
   /* cppcheck-suppress memleak */
   while (JERRY_UNLIKELY (data_space_p == NULL) && JERRY_LIKELY (pressure < max_pressure))
   {
@@ -482,6 +568,549 @@ jmem_heap_insert_block (jmem_heap_free_t *block_p, /**< block to insert */
 } /* jmem_heap_insert_block */
 #endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
 
+#if ENABLED (JERRY_MEM_SIZE_CLASSES)
+/**
+ * Return the blocks of the size class free lists to the free region list, so they can be merged
+ * into larger regions.
+ */
+void
+jmem_heap_collect_size_classes (void)
+{
+#if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+  for (uint32_t i = 0; i < JMEM_HEAP_SIZE_CLASS_COUNT; i++)
+  {
+    uint32_t block_offset = JERRY_CONTEXT (jmem_heap_size_class_offsets)[i];
+    JERRY_CONTEXT (jmem_heap_size_class_offsets)[i] = JMEM_HEAP_END_OF_LIST;
+
+    while (block_offset != JMEM_HEAP_END_OF_LIST)
+    {
+      jmem_heap_free_t *const block_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (block_offset);
+      JERRY_ASSERT (jmem_is_heap_pointer (block_p));
+
+      JMEM_VALGRIND_DEFINED_SPACE (block_p, sizeof (jmem_heap_free_t));
+      const uint32_t block_size = block_p->size;
+      block_offset = block_p->next_offset;
+      JMEM_VALGRIND_NOACCESS_SPACE (block_p, sizeof (jmem_heap_free_t));
+
+      JERRY_ASSERT (block_size == JMEM_HEAP_SIZE_CLASS_MIN + (i << JMEM_ALIGNMENT_LOG));
+      jmem_heap_insert_block (block_p, jmem_heap_find_prev (block_p), block_size);
+    }
+  }
+
+  JERRY_CONTEXT (jmem_heap_size_class_bytes) = 0;
+#endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+} /* jmem_heap_collect_size_classes */
+#endif /* ENABLED (JERRY_MEM_SIZE_CLASSES) */
+
+#if ENABLED (JERRY_MEM_SLAB_ALLOCATOR) && !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+/**
+ * Size of the slab header, the first slot of a slab starts after it
+ */
+#define JMEM_HEAP_SLAB_HEADER_SIZE JERRY_ALIGNUP (sizeof (jmem_heap_slab_t), JMEM_ALIGNMENT)
+
+JERRY_STATIC_ASSERT ((JMEM_HEAP_SLAB_SIZE - JMEM_HEAP_SLAB_HEADER_SIZE) / (2 * JMEM_ALIGNMENT) <= 32,
+                     slots_of_a_slab_must_fit_into_the_free_bitmap);
+
+/**
+ * Number of slab sized parts of the heap area
+ */
+#define JMEM_HEAP_SLAB_PAGE_COUNT ((uint32_t) (JMEM_HEAP_AREA_SIZE / JMEM_HEAP_SLAB_SIZE))
+
+/**
+ * Number of words of the bitmap which marks the slab sized parts of the heap used by slabs
+ */
+#define JMEM_HEAP_SLAB_PAGE_WORDS ((JMEM_HEAP_SLAB_PAGE_COUNT + 31) / 32)
+
+/**
+ * Get the list of slabs with free slots for a slot size.
+ */
+#define JMEM_HEAP_SLAB_LIST(slot_size) \
+  (JERRY_CONTEXT (jmem_heap_slab_lists)[((slot_size) >> JMEM_ALIGNMENT_LOG) - 2])
+
+/**
+ * Get the free bitmap of a slab whose slots are all free.
+ *
+ * @return free bitmap
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_slab_empty_bitmap (uint32_t slot_size) /**< size of the slots */
+{
+  const uint32_t slot_count = (uint32_t) ((JMEM_HEAP_SLAB_SIZE - JMEM_HEAP_SLAB_HEADER_SIZE) / slot_size);
+  return (slot_count == 32) ? UINT32_MAX : (((uint32_t) 1 << slot_count) - 1);
+} /* jmem_heap_slab_empty_bitmap */
+
+/**
+ * Get the index of the first free slot of a slab.
+ *
+ * @return slot index
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_slab_first_free_slot (uint32_t free_bitmap) /**< free bitmap of the slab */
+{
+  JERRY_ASSERT (free_bitmap != 0);
+#if defined (__GNUC__) || defined (__clang__)
+  return (uint32_t) __builtin_ctz (free_bitmap);
+#else /* !__GNUC__ && !__clang__ */
+  uint32_t slot_index = 0;
+
+  while ((free_bitmap & 0x1) == 0)
+  {
+    free_bitmap >>= 1;
+    slot_index++;
+  }
+
+  return slot_index;
+#endif /* __GNUC__ || __clang__ */
+} /* jmem_heap_slab_first_free_slot */
+
+/**
+ * Check whether a block is a slot of a slab.
+ *
+ * @return true - if the block is allocated from a slab,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_is_slab_block (const void *ptr) /**< pointer to the block */
+{
+  const uint32_t page_index = (uint32_t) ((const uint8_t *) ptr - JERRY_HEAP_CONTEXT (area)) / JMEM_HEAP_SLAB_SIZE;
+  return (JERRY_CONTEXT (jmem_heap_slab_pages_p)[page_index >> 5] & ((uint32_t) 1 << (page_index & 0x1f))) != 0;
+} /* jmem_heap_is_slab_block */
+
+/**
+ * Carve a new slab from the first free region which contains a slab aligned part of the heap,
+ * and insert it into the list of its slot size.
+ *
+ * @return pointer to the slab - if allocation is successful,
+ *         NULL - otherwise
+ */
+static jmem_heap_slab_t *
+jmem_heap_alloc_slab (uint32_t slot_size) /**< size of the slots */
+{
+  jmem_heap_free_t *prev_p = &JERRY_HEAP_CONTEXT (first);
+  JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
+  uint32_t current_offset = prev_p->next_offset;
+  JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
+
+  while (current_offset != JMEM_HEAP_END_OF_LIST)
+  {
+    jmem_heap_free_t *const current_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (current_offset);
+    JERRY_ASSERT (jmem_is_heap_pointer (current_p));
+    JMEM_VALGRIND_DEFINED_SPACE (current_p, sizeof (jmem_heap_free_t));
+
+    const uint32_t region_start = (uint32_t) ((uint8_t *) current_p - JERRY_HEAP_CONTEXT (area));
+    const uint32_t region_end = region_start + current_p->size;
+    const uint32_t slab_start = JERRY_ALIGNUP (region_start, JMEM_HEAP_SLAB_SIZE);
+    const uint32_t next_offset = current_p->next_offset;
+
+    if (slab_start + JMEM_HEAP_SLAB_SIZE <= region_end)
+    {
+      uint32_t after_offset = next_offset;
+
+      /* The part of the region after the slab stays free. */
+      if (slab_start + JMEM_HEAP_SLAB_SIZE < region_end)
+      {
+        uint8_t *const remaining_start_p = JERRY_HEAP_CONTEXT (area) + slab_start + JMEM_HEAP_SLAB_SIZE;
+        jmem_heap_free_t *const remaining_p = (jmem_heap_free_t *) remaining_start_p;
+
+        JMEM_VALGRIND_DEFINED_SPACE (remaining_p, sizeof (jmem_heap_free_t));
+        remaining_p->size = region_end - (slab_start + JMEM_HEAP_SLAB_SIZE);
+        remaining_p->next_offset = next_offset;
+        JMEM_VALGRIND_NOACCESS_SPACE (remaining_p, sizeof (jmem_heap_free_t));
+
+        after_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (remaining_p);
+      }
+
+      /* The part of the region before the slab stays free as well. */
+      if (slab_start > region_start)
+      {
+        current_p->size = slab_start - region_start;
+        current_p->next_offset = after_offset;
+      }
+      else
+      {
+        JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
+        prev_p->next_offset = after_offset;
+        JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
+      }
+
+      JMEM_VALGRIND_NOACCESS_SPACE (current_p, sizeof (jmem_heap_free_t));
+      JERRY_CONTEXT (jmem_heap_list_skip_p) = prev_p;
+
+      JERRY_CONTEXT (jmem_heap_allocated_size) += JMEM_HEAP_SLAB_SIZE;
+
+      while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
+      {
+        JERRY_CONTEXT (jmem_heap_limit) += JMEM_HEAP_GC_STEP;
+      }
+
+      const uint32_t page_index = slab_start / JMEM_HEAP_SLAB_SIZE;
+      JERRY_CONTEXT (jmem_heap_slab_pages_p)[page_index >> 5] |= (uint32_t) 1 << (page_index & 0x1f);
+
+      jmem_heap_slab_t *const slab_p = (jmem_heap_slab_t *) (JERRY_HEAP_CONTEXT (area) + slab_start);
+      JMEM_VALGRIND_DEFINED_SPACE (slab_p, sizeof (jmem_heap_slab_t));
+
+      slab_p->prev_p = NULL;
+      slab_p->next_p = JMEM_HEAP_SLAB_LIST (slot_size);
+      slab_p->free_bitmap = jmem_heap_slab_empty_bitmap (slot_size);
+      slab_p->slot_size = slot_size;
+
+      if (slab_p->next_p != NULL)
+      {
+        slab_p->next_p->prev_p = slab_p;
+      }
+
+      JMEM_HEAP_SLAB_LIST (slot_size) = slab_p;
+      return slab_p;
+    }
+
+    JMEM_VALGRIND_NOACCESS_SPACE (current_p, sizeof (jmem_heap_free_t));
+    prev_p = current_p;
+    current_offset = next_offset;
+  }
+
+  return NULL;
+} /* jmem_heap_alloc_slab */
+
+/**
+ * Remove an empty slab from the list of its slot size and return it to the heap.
+ */
+static void
+jmem_heap_free_slab (jmem_heap_slab_t *slab_p) /**< slab */
+{
+  JERRY_ASSERT (slab_p->free_bitmap == jmem_heap_slab_empty_bitmap (slab_p->slot_size));
+
+  if (slab_p->prev_p != NULL)
+  {
+    slab_p->prev_p->next_p = slab_p->next_p;
+  }
+  else
+  {
+    JMEM_HEAP_SLAB_LIST (slab_p->slot_size) = slab_p->next_p;
+  }
+
+  if (slab_p->next_p != NULL)
+  {
+    slab_p->next_p->prev_p = slab_p->prev_p;
+  }
+
+  const uint32_t page_index = (uint32_t) ((uint8_t *) slab_p - JERRY_HEAP_CONTEXT (area)) / JMEM_HEAP_SLAB_SIZE;
+  JERRY_CONTEXT (jmem_heap_slab_pages_p)[page_index >> 5] &= ~((uint32_t) 1 << (page_index & 0x1f));
+
+  JMEM_VALGRIND_NOACCESS_SPACE (slab_p, sizeof (jmem_heap_slab_t));
+
+  jmem_heap_free_t *const block_p = (jmem_heap_free_t *) slab_p;
+  jmem_heap_insert_block (block_p, jmem_heap_find_prev (block_p), JMEM_HEAP_SLAB_SIZE);
+
+  JERRY_CONTEXT (jmem_heap_allocated_size) -= JMEM_HEAP_SLAB_SIZE;
+
+#if !ENABLED (JERRY_GC_ADAPTIVE_LIMIT)
+  while (JERRY_CONTEXT (jmem_heap_allocated_size) + CONFIG_GC_LIMIT <= JERRY_CONTEXT (jmem_heap_limit))
+  {
+    JERRY_CONTEXT (jmem_heap_limit) -= CONFIG_GC_LIMIT;
+  }
+#endif /* !ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
+} /* jmem_heap_free_slab */
+#endif /* ENABLED (JERRY_MEM_SLAB_ALLOCATOR) && !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+
+#if ENABLED (JERRY_MEM_SLAB_ALLOCATOR)
+/**
+ * Return the empty slabs to the heap, so they can be merged into larger regions.
+ */
+void
+jmem_heap_collect_slabs (void)
+{
+#if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+  for (uint32_t i = 0; i < JMEM_HEAP_SLAB_CLASS_COUNT; i++)
+  {
+    jmem_heap_slab_t *slab_p = JERRY_CONTEXT (jmem_heap_slab_lists)[i];
+
+    while (slab_p != NULL)
+    {
+      jmem_heap_slab_t *const next_p = slab_p->next_p;
+
+      if (slab_p->free_bitmap == jmem_heap_slab_empty_bitmap (slab_p->slot_size))
+      {
+        jmem_heap_free_slab (slab_p);
+      }
+
+      slab_p = next_p;
+    }
+  }
+#endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+} /* jmem_heap_collect_slabs */
+#endif /* ENABLED (JERRY_MEM_SLAB_ALLOCATOR) */
+
+/**
+ * Initialize the small block allocator hooks.
+ */
+void
+JerryHeapInit (void)
+{
+#if ENABLED (JERRY_MEM_SLAB_ALLOCATOR) && !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+  for (uint32_t i = 0; i < JMEM_HEAP_SLAB_CLASS_COUNT; i++)
+  {
+    JERRY_CONTEXT (jmem_heap_slab_lists)[i] = NULL;
+  }
+
+  JERRY_CONTEXT (jmem_heap_slab_pages_p) = NULL;
+
+  /* Without the page bitmap the hooks do not allocate anything. */
+  if (JMEM_HEAP_SLAB_PAGE_COUNT > 0)
+  {
+    uint32_t *pages_p = (uint32_t *) jmem_heap_alloc (JMEM_HEAP_SLAB_PAGE_WORDS * sizeof (uint32_t));
+
+    if (pages_p != NULL)
+    {
+      memset (pages_p, 0, JMEM_HEAP_SLAB_PAGE_WORDS * sizeof (uint32_t));
+      JERRY_CONTEXT (jmem_heap_slab_pages_p) = pages_p;
+    }
+  }
+#endif /* ENABLED (JERRY_MEM_SLAB_ALLOCATOR) && !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+} /* JerryHeapInit */
+
+/**
+ * Finalize the small block allocator hooks.
+ */
+void
+JerryHeapFinalize (void)
+{
+#if ENABLED (JERRY_MEM_SLAB_ALLOCATOR) && !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+  uint32_t *pages_p = JERRY_CONTEXT (jmem_heap_slab_pages_p);
+
+  if (pages_p == NULL)
+  {
+    return;
+  }
+
+  jmem_heap_collect_slabs ();
+
+  for (uint32_t i = 0; i < JMEM_HEAP_SLAB_CLASS_COUNT; i++)
+  {
+    JERRY_ASSERT (JERRY_CONTEXT (jmem_heap_slab_lists)[i] == NULL);
+  }
+
+  JERRY_CONTEXT (jmem_heap_slab_pages_p) = NULL;
+  jmem_heap_free_block_internal (pages_p, JMEM_HEAP_SLAB_PAGE_WORDS * sizeof (uint32_t));
+#endif /* ENABLED (JERRY_MEM_SLAB_ALLOCATOR) && !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+} /* JerryHeapFinalize */
+
+/**
+ * Allocate a small block from the slab of its size.
+ *
+ * Note:
+ *      the slabs are accounted in the allocated heap size when they are carved from the heap
+ *
+ * @return pointer to the allocated block - if allocation is successful,
+ *         NULL - otherwise, the block is allocated from the heap in this case
+ */
+void * JERRY_ATTR_HOT
+JerryHeapMalloc (uint32_t size) /**< size of the block, at most JMEM_HEAP_SLAB_MAX_SIZE */
+{
+#if ENABLED (JERRY_MEM_SLAB_ALLOCATOR) && !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+  JERRY_ASSERT (size > JMEM_ALIGNMENT && size <= JMEM_HEAP_SLAB_MAX_SIZE);
+
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (jmem_heap_slab_pages_p) == NULL))
+  {
+    return NULL;
+  }
+
+  const uint32_t slot_size = JERRY_ALIGNUP (size, JMEM_ALIGNMENT);
+  jmem_heap_slab_t *slab_p = JMEM_HEAP_SLAB_LIST (slot_size);
+
+  if (JERRY_UNLIKELY (slab_p == NULL))
+  {
+    slab_p = jmem_heap_alloc_slab (slot_size);
+
+    if (slab_p == NULL)
+    {
+      return NULL;
+    }
+  }
+
+  JERRY_ASSERT (slab_p->slot_size == slot_size && slab_p->free_bitmap != 0);
+
+  const uint32_t slot_index = jmem_heap_slab_first_free_slot (slab_p->free_bitmap);
+  slab_p->free_bitmap &= slab_p->free_bitmap - 1;
+
+  /* Full slabs are not kept on the list. */
+  if (slab_p->free_bitmap == 0)
+  {
+    JMEM_HEAP_SLAB_LIST (slot_size) = slab_p->next_p;
+
+    if (slab_p->next_p != NULL)
+    {
+      slab_p->next_p->prev_p = NULL;
+    }
+
+    slab_p->next_p = NULL;
+  }
+
+  uint8_t *slot_p = (uint8_t *) slab_p + JMEM_HEAP_SLAB_HEADER_SIZE + slot_index * slot_size;
+  JMEM_VALGRIND_MALLOCLIKE_SPACE (slot_p, size);
+  return (void *) slot_p;
+#else /* !ENABLED (JERRY_MEM_SLAB_ALLOCATOR) || ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+  JERRY_UNUSED (size);
+  return NULL;
+#endif /* ENABLED (JERRY_MEM_SLAB_ALLOCATOR) && !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+} /* JerryHeapMalloc */
+
+/**
+ * Free a small block if it was allocated from a slab.
+ *
+ * @return true - if the block is freed,
+ *         false - if the block was not allocated by JerryHeapMalloc
+ */
+bool JERRY_ATTR_HOT
+JerryHeapFree (void *addr) /**< pointer to the block */
+{
+#if ENABLED (JERRY_MEM_SLAB_ALLOCATOR) && !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (jmem_heap_slab_pages_p) == NULL))
+  {
+    return false;
+  }
+
+  JERRY_ASSERT (jmem_is_heap_pointer (addr));
+
+  if (!jmem_heap_is_slab_block (addr))
+  {
+    return false;
+  }
+
+  const uint32_t offset = (uint32_t) ((uint8_t *) addr - JERRY_HEAP_CONTEXT (area));
+  const uint32_t page_index = offset / JMEM_HEAP_SLAB_SIZE;
+
+  jmem_heap_slab_t *slab_p = (jmem_heap_slab_t *) (JERRY_HEAP_CONTEXT (area) + page_index * JMEM_HEAP_SLAB_SIZE);
+  const uint32_t slot_offset = (uint32_t) (offset - page_index * JMEM_HEAP_SLAB_SIZE - JMEM_HEAP_SLAB_HEADER_SIZE);
+  const uint32_t slot_bit = (uint32_t) 1 << (slot_offset / slab_p->slot_size);
+
+  JERRY_ASSERT (slot_offset % slab_p->slot_size == 0);
+  JERRY_ASSERT ((slab_p->free_bitmap & slot_bit) == 0);
+
+  JMEM_VALGRIND_FREELIKE_SPACE (addr);
+
+  /* The slab was full, it has a free slot again. */
+  if (slab_p->free_bitmap == 0)
+  {
+    slab_p->prev_p = NULL;
+    slab_p->next_p = JMEM_HEAP_SLAB_LIST (slab_p->slot_size);
+
+    if (slab_p->next_p != NULL)
+    {
+      slab_p->next_p->prev_p = slab_p;
+    }
+
+    JMEM_HEAP_SLAB_LIST (slab_p->slot_size) = slab_p;
+  }
+
+  slab_p->free_bitmap |= slot_bit;
+
+  /* An empty slab is kept only if it is the last one of its slot size, so a block which is
+   * allocated and freed repeatedly does not carve a new slab each time. */
+  if (slab_p->free_bitmap == jmem_heap_slab_empty_bitmap (slab_p->slot_size)
+      && (slab_p->prev_p != NULL || slab_p->next_p != NULL))
+  {
+    jmem_heap_free_slab (slab_p);
+  }
+
+  return true;
+#else /* !ENABLED (JERRY_MEM_SLAB_ALLOCATOR) || ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+  JERRY_UNUSED (addr);
+  return false;
+#endif /* ENABLED (JERRY_MEM_SLAB_ALLOCATOR) && !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+} /* JerryHeapFree */
+
+#if ENABLED (JERRY_GC_COMPACTION)
+/**
+ * Move an allocated block into the first free region below it which is large enough.
+ *
+ * Note:
+ *      the caller must update every reference to the block,
+ *      the blocks allocated from slabs are not moved
+ *
+ * @return new address of the block - if the block is moved,
+ *         the original address - otherwise
+ */
+void *
+jmem_heap_relocate_block (void *ptr, /**< pointer to beginning of data space of the block */
+                          const size_t size) /**< size of allocated region */
+{
+#if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+  JERRY_ASSERT (jmem_is_heap_pointer (ptr));
+
+#if ENABLED (JERRY_MEM_SLAB_ALLOCATOR)
+  if (JERRY_CONTEXT (jmem_heap_slab_pages_p) != NULL && jmem_heap_is_slab_block (ptr))
+  {
+    return ptr;
+  }
+#endif /* ENABLED (JERRY_MEM_SLAB_ALLOCATOR) */
+
+  const uint32_t required_size = (uint32_t) JERRY_ALIGNUP (size, JMEM_ALIGNMENT);
+  const uint32_t block_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (ptr);
+
+  jmem_heap_free_t *prev_p = &JERRY_HEAP_CONTEXT (first);
+  JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
+  uint32_t current_offset = prev_p->next_offset;
+  JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
+
+  /* The free region list is address ordered. */
+  while (current_offset < block_offset)
+  {
+    jmem_heap_free_t *const current_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (current_offset);
+    JERRY_ASSERT (jmem_is_heap_pointer (current_p));
+    JMEM_VALGRIND_DEFINED_SPACE (current_p, sizeof (jmem_heap_free_t));
+
+    const uint32_t next_offset = current_p->next_offset;
+
+    if (current_p->size >= required_size)
+    {
+      uint32_t after_offset = next_offset;
+
+      if (current_p->size > required_size)
+      {
+        jmem_heap_free_t *const remaining_p = (jmem_heap_free_t *) ((uint8_t *) current_p + required_size);
+
+        JMEM_VALGRIND_DEFINED_SPACE (remaining_p, sizeof (jmem_heap_free_t));
+        remaining_p->size = current_p->size - required_size;
+        remaining_p->next_offset = next_offset;
+        JMEM_VALGRIND_NOACCESS_SPACE (remaining_p, sizeof (jmem_heap_free_t));
+
+        after_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (remaining_p);
+      }
+
+      JMEM_VALGRIND_NOACCESS_SPACE (current_p, sizeof (jmem_heap_free_t));
+
+      JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
+      prev_p->next_offset = after_offset;
+      JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
+
+      JERRY_CONTEXT (jmem_heap_list_skip_p) = prev_p;
+
+      JMEM_VALGRIND_MALLOCLIKE_SPACE (current_p, size);
+      memcpy (current_p, ptr, size);
+      JMEM_VALGRIND_FREELIKE_SPACE (ptr);
+
+      /* The old block is merged with its neighbours, it is not kept on a size class free list. */
+      jmem_heap_free_t *const block_p = (jmem_heap_free_t *) ptr;
+      jmem_heap_insert_block (block_p, jmem_heap_find_prev (block_p), required_size);
+
+#if ENABLED (JERRY_MEM_STATS)
+      JERRY_CONTEXT (jmem_heap_stats).compact_moved_bytes += required_size;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+      return (void *) current_p;
+    }
+
+    JMEM_VALGRIND_NOACCESS_SPACE (current_p, sizeof (jmem_heap_free_t));
+    prev_p = current_p;
+    current_offset = next_offset;
+  }
+#else /* ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+  JERRY_UNUSED (size);
+#endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+
+  return ptr;
+} /* jmem_heap_relocate_block */
+#endif /* ENABLED (JERRY_GC_COMPACTION) */
+
 /**
  * Internal method for freeing a memory block.
  */
@@ -490,19 +1119,14 @@ jmem_heap_free_block_internal (void *ptr, /**< pointer to beginning of data spac
                                const size_t size) /**< size of allocated region */
 {
   JERRY_ASSERT (size > 0);
+#if !ENABLED (JERRY_GC_ADAPTIVE_LIMIT)
   JERRY_ASSERT (JERRY_CONTEXT (jmem_heap_limit) >= JERRY_CONTEXT (jmem_heap_allocated_size));
+#endif /* !ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
   JERRY_ASSERT (JERRY_CONTEXT (jmem_heap_allocated_size) > 0);
 
-  if (JerryHeapFree(ptr)) {
-      JERRY_CONTEXT (jmem_heap_allocated_size) -= size;
-
-      while (JERRY_CONTEXT (jmem_heap_allocated_size) + CONFIG_GC_LIMIT <= JERRY_CONTEXT(jmem_heap_limit))
-      {
-        JERRY_CONTEXT(jmem_heap_limit) -= CONFIG_GC_LIMIT;
-      }
-
-      JERRY_ASSERT (JERRY_CONTEXT(jmem_heap_limit) >= JERRY_CONTEXT(jmem_heap_allocated_size));
-      return;
+  if (size > JMEM_ALIGNMENT && size <= JMEM_HEAP_SLAB_MAX_SIZE && JerryHeapFree (ptr))
+  {
+    return;
   }
 
 #if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
@@ -513,8 +1137,27 @@ jmem_heap_free_block_internal (void *ptr, /**< pointer to beginning of data spac
   const size_t aligned_size = (size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT * JMEM_ALIGNMENT;
 
   jmem_heap_free_t *const block_p = (jmem_heap_free_t *) ptr;
-  jmem_heap_free_t *const prev_p = jmem_heap_find_prev (block_p);
-  jmem_heap_insert_block (block_p, prev_p, aligned_size);
+
+#if ENABLED (JERRY_MEM_SIZE_CLASSES)
+  if (JMEM_HEAP_IS_SIZE_CLASS (aligned_size))
+  {
+    /* The block is not merged with its neighbours, it is reused by allocations of the same size. */
+    JMEM_VALGRIND_DEFINED_SPACE (block_p, sizeof (jmem_heap_free_t));
+    block_p->size = (uint32_t) aligned_size;
+    block_p->next_offset = JMEM_HEAP_SIZE_CLASS_HEAD (aligned_size);
+    JMEM_VALGRIND_NOACCESS_SPACE (block_p, sizeof (jmem_heap_free_t));
+
+    JMEM_HEAP_SIZE_CLASS_HEAD (aligned_size) = JMEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
+    JERRY_CONTEXT (jmem_heap_size_class_bytes) += aligned_size;
+  }
+  else
+  {
+#endif /* ENABLED (JERRY_MEM_SIZE_CLASSES) */
+    jmem_heap_free_t *const prev_p = jmem_heap_find_prev (block_p);
+    jmem_heap_insert_block (block_p, prev_p, aligned_size);
+#if ENABLED (JERRY_MEM_SIZE_CLASSES)
+  }
+#endif /* ENABLED (JERRY_MEM_SIZE_CLASSES) */
 
   JERRY_CONTEXT (jmem_heap_allocated_size) -= aligned_size;
 
@@ -523,12 +1166,14 @@ jmem_heap_free_block_internal (void *ptr, /**< pointer to beginning of data spac
   JERRY_CONTEXT (jmem_heap_allocated_size) -= size;
   free (ptr);
 #endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+#if !ENABLED (JERRY_GC_ADAPTIVE_LIMIT)
   while (JERRY_CONTEXT (jmem_heap_allocated_size) + CONFIG_GC_LIMIT <= JERRY_CONTEXT (jmem_heap_limit))
   {
     JERRY_CONTEXT (jmem_heap_limit) -= CONFIG_GC_LIMIT;
   }
 
   JERRY_ASSERT (JERRY_CONTEXT (jmem_heap_limit) >= JERRY_CONTEXT (jmem_heap_allocated_size));
+#endif /* !ENABLED (JERRY_GC_ADAPTIVE_LIMIT) */
 } /* jmem_heap_free_block_internal */
 
 /**
@@ -595,6 +1240,48 @@ jmem_is_heap_pointer (const void *pointer) /**< pointer */
 #endif /* !JERRY_NDEBUG */
 
 #if ENABLED (JERRY_MEM_STATS)
+/**
+ * Update the fragmentation statistics by walking the free region list
+ */
+static void
+jmem_heap_stat_free_regions (void)
+{
+  jmem_heap_stats_t *heap_stats = &JERRY_CONTEXT (jmem_heap_stats);
+
+  heap_stats->free_region_count = 0;
+  heap_stats->free_region_bytes = 0;
+  heap_stats->largest_free_region = 0;
+  heap_stats->size_class_bytes = 0;
+
+#if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+  JMEM_VALGRIND_DEFINED_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+  uint32_t region_offset = JERRY_HEAP_CONTEXT (first).next_offset;
+  JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+
+  while (region_offset != JMEM_HEAP_END_OF_LIST)
+  {
+    jmem_heap_free_t *const region_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (region_offset);
+    JERRY_ASSERT (jmem_is_heap_pointer (region_p));
+
+    JMEM_VALGRIND_DEFINED_SPACE (region_p, sizeof (jmem_heap_free_t));
+    heap_stats->free_region_count++;
+    heap_stats->free_region_bytes += region_p->size;
+
+    if (region_p->size > heap_stats->largest_free_region)
+    {
+      heap_stats->largest_free_region = region_p->size;
+    }
+
+    region_offset = region_p->next_offset;
+    JMEM_VALGRIND_NOACCESS_SPACE (region_p, sizeof (jmem_heap_free_t));
+  }
+
+#if ENABLED (JERRY_MEM_SIZE_CLASSES)
+  heap_stats->size_class_bytes = JERRY_CONTEXT (jmem_heap_size_class_bytes);
+#endif /* ENABLED (JERRY_MEM_SIZE_CLASSES) */
+#endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+} /* jmem_heap_stat_free_regions */
+
 /**
  * Get heap memory usage statistics
  */
@@ -603,9 +1290,32 @@ jmem_heap_get_stats (jmem_heap_stats_t *out_heap_stats_p) /**< [out] heap stats
 {
   JERRY_ASSERT (out_heap_stats_p != NULL);
 
+  jmem_heap_stat_free_regions ();
   *out_heap_stats_p = JERRY_CONTEXT (jmem_heap_stats);
 } /* jmem_heap_get_stats */
 
+/**
+ * Record the largest free region before or after a heap compaction
+ */
+void
+jmem_stats_heap_compact (bool is_finished) /**< true - if the compaction is finished,
+                                            *   false - if it is started */
+{
+  jmem_heap_stats_t *heap_stats = &JERRY_CONTEXT (jmem_heap_stats);
+
+  jmem_heap_stat_free_regions ();
+
+  if (is_finished)
+  {
+    heap_stats->compact_largest_free_after = heap_stats->largest_free_region;
+  }
+  else
+  {
+    heap_stats->compact_count++;
+    heap_stats->compact_largest_free_before = heap_stats->largest_free_region;
+  }
+} /* jmem_stats_heap_compact */
+
 /**
  * Print heap memory usage statistics
  */
@@ -614,6 +1324,8 @@ jmem_heap_stats_print (void)
 {
   jmem_heap_stats_t *heap_stats = &JERRY_CONTEXT (jmem_heap_stats);
 
+  jmem_heap_stat_free_regions ();
+
   JERRY_DEBUG_MSG ("Heap stats:\n");
 #if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
   JERRY_DEBUG_MSG ("  Heap size = %"PRI_SIZET" bytes\n",
@@ -643,6 +1355,45 @@ jmem_heap_stats_print (void)
                    (MSG_SIZE_TYPE)(heap_stats->peak_object_bytes),
                    (MSG_SIZE_TYPE)(heap_stats->property_bytes),
                    (MSG_SIZE_TYPE)(heap_stats->peak_property_bytes));
+
+#if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+  JERRY_DEBUG_MSG ("  Free regions = %"PRI_SIZET"\n"
+                   "  Free region bytes = %"PRI_SIZET" bytes\n"
+                   "  Largest free region = %"PRI_SIZET" bytes\n"
+                   "  Size class free list bytes = %"PRI_SIZET" bytes\n",
+                   (MSG_SIZE_TYPE)(heap_stats->free_region_count),
+                   (MSG_SIZE_TYPE)(heap_stats->free_region_bytes),
+                   (MSG_SIZE_TYPE)(heap_stats->largest_free_region),
+                   (MSG_SIZE_TYPE)(heap_stats->size_class_bytes));
+#endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+
+#if ENABLED (JERRY_GC_COMPACTION)
+  JERRY_DEBUG_MSG ("  Compactions = %"PRI_SIZET"\n"
+                   "  Compaction moved bytes = %"PRI_SIZET" bytes\n"
+                   "  Largest free region before last compaction = %"PRI_SIZET" bytes\n"
+                   "  Largest free region after last compaction = %"PRI_SIZET" bytes\n",
+                   (MSG_SIZE_TYPE)(heap_stats->compact_count),
+                   (MSG_SIZE_TYPE)(heap_stats->compact_moved_bytes),
+                   (MSG_SIZE_TYPE)(heap_stats->compact_largest_free_before),
+                   (MSG_SIZE_TYPE)(heap_stats->compact_largest_free_after));
+#endif /* ENABLED (JERRY_GC_COMPACTION) */
+
+  const jmem_telemetry_t *telemetry_p = &JERRY_CONTEXT (jmem_telemetry);
+
+  JERRY_DEBUG_MSG ("  GC pauses:\n");
+
+  for (uint32_t i = 0; i < JMEM_GC_PAUSE_HISTOGRAM_SIZE - 1; i++)
+  {
+    JERRY_DEBUG_MSG ("    < %u us = %"PRI_SIZET"\n",
+                     (unsigned int) (250u << i),
+                     (MSG_SIZE_TYPE)(telemetry_p->gc_pause_histogram[i]));
+  }
+
+  JERRY_DEBUG_MSG ("    >= %u us = %"PRI_SIZET"\n",
+                   (unsigned int) (250u << (JMEM_GC_PAUSE_HISTOGRAM_SIZE - 2)),
+                   (MSG_SIZE_TYPE)(telemetry_p->gc_pause_histogram[JMEM_GC_PAUSE_HISTOGRAM_SIZE - 1]));
+  JERRY_DEBUG_MSG ("  GC pause total = %"PRI_SIZET" us\n",
+                   (MSG_SIZE_TYPE)(heap_stats->gc_pause_total_us));
 } /* jmem_heap_stats_print */
 
 /**
@@ -139,6 +139,63 @@ typedef struct
   uint32_t size; /**< Size of region */
 } jmem_heap_free_t;
 
+#if ENABLED (JERRY_MEM_SIZE_CLASSES)
+/**
+ * Smallest block size which has a size class free list
+ */
+#define JMEM_HEAP_SIZE_CLASS_MIN (2 * JMEM_ALIGNMENT)
+
+/**
+ * Largest block size which has a size class free list
+ */
+#define JMEM_HEAP_SIZE_CLASS_MAX (16 * JMEM_ALIGNMENT)
+
+/**
+ * Number of size classes: one for each aligned size between the smallest and largest block size
+ */
+#define JMEM_HEAP_SIZE_CLASS_COUNT ((JMEM_HEAP_SIZE_CLASS_MAX - JMEM_HEAP_SIZE_CLASS_MIN) / JMEM_ALIGNMENT + 1)
+
+void jmem_heap_collect_size_classes (void);
+#endif /* ENABLED (JERRY_MEM_SIZE_CLASSES) */
+
+/**
+ * Largest block size which is passed to the JerryHeapMalloc / JerryHeapFree hooks
+ *
+ * Note:
+ *      blocks of at most JMEM_ALIGNMENT bytes are always allocated from the heap
+ */
+#define JMEM_HEAP_SLAB_MAX_SIZE (3 * JMEM_ALIGNMENT)
+
+#if ENABLED (JERRY_MEM_SLAB_ALLOCATOR)
+/**
+ * Size of a slab, slabs are aligned to their size inside the heap area
+ */
+#define JMEM_HEAP_SLAB_SIZE (64 * JMEM_ALIGNMENT)
+
+/**
+ * Number of slab lists: one for each aligned block size served by the slab allocator
+ */
+#define JMEM_HEAP_SLAB_CLASS_COUNT (JMEM_HEAP_SLAB_MAX_SIZE / JMEM_ALIGNMENT - 1)
+
+/**
+ * Slab header, followed by the slots of the slab
+ */
+typedef struct jmem_heap_slab_t
+{
+  struct jmem_heap_slab_t *prev_p; /**< previous slab with free slots of the same slot size */
+  struct jmem_heap_slab_t *next_p; /**< next slab with free slots of the same slot size */
+  uint32_t free_bitmap; /**< a bit is set for each free slot */
+  uint32_t slot_size; /**< size of the slots */
+} jmem_heap_slab_t;
+
+void jmem_heap_collect_slabs (void);
+#endif /* ENABLED (JERRY_MEM_SLAB_ALLOCATOR) */
+
+void JerryHeapInit (void);
+void JerryHeapFinalize (void);
+void *JerryHeapMalloc (uint32_t size);
+bool JerryHeapFree (void *addr);
+
 void jmem_init (void);
 void jmem_finalize (void);
 
@@ -147,6 +204,48 @@ void *jmem_heap_alloc_block_null_on_error (const size_t size);
 void *jmem_heap_realloc_block (void *ptr, const size_t old_size, const size_t new_size);
 void jmem_heap_free_block (void *ptr, const size_t size);
 
+#if ENABLED (JERRY_GC_COMPACTION)
+void *jmem_heap_relocate_block (void *ptr, const size_t size);
+#endif /* ENABLED (JERRY_GC_COMPACTION) */
+
+/**
+ * Number of allocation size classes of the telemetry counters
+ */
+#define JMEM_TELEMETRY_SIZE_CLASS_COUNT 16
+
+/**
+ * Number of buckets of the garbage collector pause histogram
+ */
+#define JMEM_GC_PAUSE_HISTOGRAM_SIZE 8
+
+/**
+ * Garbage collector and allocator telemetry, maintained in every build
+ */
+typedef struct
+{
+  size_t gc_count; /**< number of finished garbage collection cycles */
+  size_t gc_pause_count; /**< number of garbage collector pauses */
+  size_t gc_pause_total_us; /**< total length of the garbage collector pauses in microseconds */
+  size_t gc_pause_max_us; /**< length of the longest garbage collector pause in microseconds */
+  size_t gc_pause_histogram[JMEM_GC_PAUSE_HISTOGRAM_SIZE]; /**< number of garbage collector pauses, the upper
+                                                            *   bound of bucket i is 0.25 * 2^i milliseconds,
+                                                            *   the last bucket is unbounded */
+  size_t gc_marked_objects; /**< number of objects kept alive by the last collection cycle */
+  size_t gc_swept_objects; /**< number of unreachable objects found by the last collection cycle */
+  size_t gc_marked_objects_total; /**< number of objects kept alive by all collection cycles */
+  size_t gc_swept_objects_total; /**< number of unreachable objects found by all collection cycles */
+
+  size_t alloc_count[JMEM_TELEMETRY_SIZE_CLASS_COUNT]; /**< number of allocations, bucket i counts the
+                                                        *   blocks of (i + 1) * JMEM_ALIGNMENT bytes,
+                                                        *   the last bucket counts the larger blocks too */
+  size_t first_fit_count; /**< number of allocations which walked the free region list */
+  size_t first_fit_steps; /**< total number of free regions visited by these walks */
+  size_t first_fit_max_steps; /**< number of free regions visited by the longest walk */
+} jmem_telemetry_t;
+
+void jmem_telemetry_gc_pause (double pause_ms);
+void jmem_telemetry_gc_cycle (size_t marked_objects, size_t swept_objects);
+
 #if ENABLED (JERRY_MEM_STATS)
 /**
  * Heap memory usage statistics
@@ -172,6 +271,18 @@ typedef struct
 
   size_t property_bytes; /**< allocated memory for properties */
   size_t peak_property_bytes; /**< peak allocated memory for properties */
+
+  size_t gc_pause_total_us; /**< total length of the garbage collector pauses in microseconds */
+
+  size_t free_region_count; /**< number of regions on the free region list */
+  size_t free_region_bytes; /**< total size of the regions on the free region list */
+  size_t largest_free_region; /**< size of the largest region on the free region list */
+  size_t size_class_bytes; /**< total size of the blocks on the size class free lists */
+
+  size_t compact_count; /**< number of heap compactions */
+  size_t compact_moved_bytes; /**< total size of the blocks moved by heap compactions */
+  size_t compact_largest_free_before; /**< largest free region before the last compaction */
+  size_t compact_largest_free_after; /**< largest free region after the last compaction */
 } jmem_heap_stats_t;
 
 void jmem_stats_allocate_byte_code_bytes (size_t property_size);
@@ -182,6 +293,8 @@ void jmem_stats_allocate_object_bytes (size_t object_size);
 void jmem_stats_free_object_bytes (size_t string_size);
 void jmem_stats_allocate_property_bytes (size_t property_size);
 void jmem_stats_free_property_bytes (size_t property_size);
+void jmem_stats_gc_pause (double pause_ms);
+void jmem_stats_heap_compact (bool is_finished);
 
 void jmem_heap_get_stats (jmem_heap_stats_t *);
 void jmem_heap_stats_reset_peak (void);
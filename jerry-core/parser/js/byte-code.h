@@ -78,6 +78,21 @@
 #define CBC_EXT_NO_RESULT_OPERATION(opcode) false
 #endif /* ENABLED (JERRY_ES2015) */
 
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+/**
+ * Checks whether the opcode is a three-address binary opcode. These opcodes have
+ * no result, but they must be split before converting them to a result form.
+ */
+#define CBC_EXT_BINARY_TO_IDENT_OPERATION(opcode) \
+  ((opcode) >= PARSER_TO_EXT_OPCODE (CBC_EXT_BIT_OR_TO_IDENT) \
+    && (opcode) <= PARSER_TO_EXT_OPCODE (CBC_EXT_MODULO_TWO_LITERALS_TO_IDENT))
+#else /* !ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+/**
+ * Checks whether the opcode is a three-address binary opcode.
+ */
+#define CBC_EXT_BINARY_TO_IDENT_OPERATION(opcode) false
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+
 /* Debug macro. */
 #define CBC_ARGS_EQ(op, types) \
   ((cbc_flags[op] & CBC_ARG_TYPES) == (types))
@@ -102,6 +117,48 @@
   CBC_OPCODE (name ## _TWO_LITERALS, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 1, \
               (VM_OC_ ## group) | VM_OC_GET_LITERAL_LITERAL | VM_OC_PUT_STACK)
 
+/**
+ * Superinstructions which fuse a comparison with the conditional branch after it.
+ *
+ * These opcodes are never emitted by the code generator: the post processing
+ * replaces the comparison opcode with its fused form when the next instruction
+ * is a CBC_BRANCH_IF_TRUE or CBC_BRANCH_IF_FALSE branch. The branch instruction
+ * is kept in the byte code (so the length of the byte code and the branch offsets
+ * are unchanged) and it is executed by the superinstruction. The stack change
+ * does not include the effect of the branch.
+ */
+#define CBC_COMPARE_AND_BRANCH_OPERATION(name, group) \
+  CBC_OPCODE (name ## _AND_BRANCH, CBC_NO_FLAG, -2, \
+              (VM_OC_ ## group ## _AND_BRANCH) | VM_OC_GET_STACK_STACK) \
+  CBC_OPCODE (name ## _TWO_LITERALS_AND_BRANCH, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, \
+              (VM_OC_ ## group ## _AND_BRANCH) | VM_OC_GET_LITERAL_LITERAL)
+
+/**
+ * Three-address forms of binary operations.
+ *
+ * These opcodes are emitted instead of a binary operation when its result is
+ * assigned to an identifier by the next instruction. The last literal argument
+ * is the destination identifier (or register), and the result is stored there
+ * instead of being pushed onto the stack.
+ */
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+#define CBC_BINARY_TO_IDENT_OPERATION(name, group) \
+  CBC_OPCODE (name ## _TO_IDENT, CBC_HAS_LITERAL_ARG, -2, \
+              (VM_OC_ ## group) | VM_OC_GET_STACK_STACK | VM_OC_PUT_IDENT) \
+  CBC_OPCODE (name ## _RIGHT_LITERAL_TO_IDENT, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, -1, \
+              (VM_OC_ ## group) | VM_OC_GET_STACK_LITERAL | VM_OC_PUT_IDENT) \
+  CBC_OPCODE (name ## _TWO_LITERALS_TO_IDENT, CBC_HAS_LITERAL_ARG2, 0, \
+              (VM_OC_ ## group) | VM_OC_GET_LITERAL_LITERAL | VM_OC_PUT_IDENT)
+#else /* !ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+#define CBC_BINARY_TO_IDENT_OPERATION(name, group) \
+  CBC_OPCODE (name ## _TO_IDENT, CBC_HAS_LITERAL_ARG, -2, \
+              VM_OC_NONE) \
+  CBC_OPCODE (name ## _RIGHT_LITERAL_TO_IDENT, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, -1, \
+              VM_OC_NONE) \
+  CBC_OPCODE (name ## _TWO_LITERALS_TO_IDENT, CBC_HAS_LITERAL_ARG2, 0, \
+              VM_OC_NONE)
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+
 #define CBC_UNARY_LVALUE_OPERATION(name, group) \
   CBC_OPCODE (name, CBC_NO_FLAG, -2, \
               (VM_OC_PROP_ ## group) | VM_OC_GET_STACK_STACK | VM_OC_PUT_REFERENCE) \
@@ -140,7 +197,9 @@
  * cannot be true for an opcode which has a result
  */
 #define CBC_NO_RESULT_OPERATION(opcode) \
-  (((opcode) >= CBC_PRE_INCR && (opcode) < CBC_END) || CBC_EXT_NO_RESULT_OPERATION ((opcode)))
+  (((opcode) >= CBC_PRE_INCR && (opcode) < CBC_END) \
+   || CBC_EXT_NO_RESULT_OPERATION ((opcode)) \
+   || CBC_EXT_BINARY_TO_IDENT_OPERATION ((opcode)))
 
 /**
  * Branch instructions are organized in group of 8 opcodes.
@@ -513,6 +572,20 @@
   CBC_OPCODE (CBC_ASSIGN_SUPER_BLOCK, CBC_NO_FLAG, -3, \
               VM_OC_ASSIGN_SUPER | VM_OC_PUT_BLOCK) \
   \
+  /* Superinstructions, must be in the same order as the comparison opcodes. */ \
+  CBC_COMPARE_AND_BRANCH_OPERATION (CBC_STRICT_EQUAL, \
+                                    STRICT_EQUAL) \
+  CBC_COMPARE_AND_BRANCH_OPERATION (CBC_STRICT_NOT_EQUAL, \
+                                    STRICT_NOT_EQUAL) \
+  CBC_COMPARE_AND_BRANCH_OPERATION (CBC_LESS, \
+                                    LESS) \
+  CBC_COMPARE_AND_BRANCH_OPERATION (CBC_GREATER, \
+                                    GREATER) \
+  CBC_COMPARE_AND_BRANCH_OPERATION (CBC_LESS_EQUAL, \
+                                    LESS_EQUAL) \
+  CBC_COMPARE_AND_BRANCH_OPERATION (CBC_GREATER_EQUAL, \
+                                    GREATER_EQUAL) \
+  \
   /* Last opcode (not a real opcode). */ \
   CBC_OPCODE (CBC_END, CBC_NO_FLAG, 0, \
               VM_OC_NONE)
@@ -727,6 +800,50 @@
   CBC_OPCODE (CBC_EXT_PUSH_NEW_TARGET, CBC_NO_FLAG, 1, \
               VM_OC_PUSH_NEW_TARGET | VM_OC_PUT_STACK) \
   \
+  /* Three-address binary opcodes, must be in the same order as the binary opcodes. */ \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_BIT_OR, \
+                                 BIT_OR) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_BIT_XOR, \
+                                 BIT_XOR) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_BIT_AND, \
+                                 BIT_AND) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_EQUAL, \
+                                 EQUAL) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_NOT_EQUAL, \
+                                 NOT_EQUAL) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_STRICT_EQUAL, \
+                                 STRICT_EQUAL) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_STRICT_NOT_EQUAL, \
+                                 STRICT_NOT_EQUAL) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_LESS, \
+                                 LESS) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_GREATER, \
+                                 GREATER) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_LESS_EQUAL, \
+                                 LESS_EQUAL) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_GREATER_EQUAL, \
+                                 GREATER_EQUAL) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_IN, \
+                                 IN) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_INSTANCEOF, \
+                                 INSTANCEOF) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_LEFT_SHIFT, \
+                                 LEFT_SHIFT) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_RIGHT_SHIFT, \
+                                 RIGHT_SHIFT) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_UNS_RIGHT_SHIFT, \
+                                 UNS_RIGHT_SHIFT) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_ADD, \
+                                 ADD) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_SUBTRACT, \
+                                 SUB) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_MULTIPLY, \
+                                 MUL) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_DIVIDE, \
+                                 DIV) \
+  CBC_BINARY_TO_IDENT_OPERATION (CBC_EXT_MODULO, \
+                                 MOD) \
+  \
   /* Last opcode (not a real opcode). */ \
   CBC_OPCODE (CBC_EXT_END, CBC_NO_FLAG, 0, \
               VM_OC_NONE)
@@ -80,12 +80,99 @@ JERRY_STATIC_ASSERT (sizeof (parser_binary_precedence_table) == 36,
                      parser_binary_precedence_table_should_have_36_values_in_es51);
 #endif /* ENABLED (JERRY_ES2015) */
 
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+
+JERRY_STATIC_ASSERT (CBC_EXT_MODULO_TWO_LITERALS_TO_IDENT - CBC_EXT_BIT_OR_TO_IDENT
+                     == CBC_MODULO_TWO_LITERALS - CBC_BIT_OR,
+                     three_address_opcodes_must_be_in_the_same_order_as_binary_opcodes);
+JERRY_STATIC_ASSERT (CBC_EXT_ADD_RIGHT_LITERAL_TO_IDENT - CBC_EXT_BIT_OR_TO_IDENT
+                     == CBC_ADD_RIGHT_LITERAL - CBC_BIT_OR,
+                     three_address_add_opcode_must_be_in_the_same_position_as_binary_add_opcode);
+
+/**
+ * Merge an identifier assignment into the binary operation which computes
+ * the assigned value.
+ *
+ * Note: the binary operation must be the last byte code, so no branch can
+ *       target the assignment.
+ *
+ * @return true - if the assignment is merged, false - otherwise
+ */
+bool
+parser_merge_binary_to_ident (parser_context_t *context_p, /**< context */
+                              uint16_t literal_index) /**< literal index of the identifier */
+{
+  uint16_t opcode = context_p->last_cbc_opcode;
+
+  if (opcode < CBC_BIT_OR || opcode > CBC_MODULO_TWO_LITERALS)
+  {
+    return false;
+  }
+
+  uint8_t arg_types = cbc_flags[opcode] & CBC_ARG_TYPES;
+
+  if (arg_types == CBC_NO_FLAG)
+  {
+    context_p->last_cbc.literal_index = literal_index;
+  }
+  else if (arg_types == CBC_HAS_LITERAL_ARG)
+  {
+    context_p->last_cbc.value = literal_index;
+  }
+  else
+  {
+    JERRY_ASSERT (arg_types == (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2));
+    context_p->last_cbc.third_literal_index = literal_index;
+  }
+
+  context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (CBC_EXT_BIT_OR_TO_IDENT + (opcode - CBC_BIT_OR));
+  return true;
+} /* parser_merge_binary_to_ident */
+
+/**
+ * Split a three-address binary opcode into the binary opcode and
+ * the identifier assignment, which has a result form.
+ */
+static void
+parser_split_binary_to_ident (parser_context_t *context_p) /**< context */
+{
+  uint16_t opcode = (uint16_t) (CBC_BIT_OR + (PARSER_GET_EXT_OPCODE (context_p->last_cbc_opcode)
+                                              - CBC_EXT_BIT_OR_TO_IDENT));
+  uint8_t arg_types = cbc_flags[opcode] & CBC_ARG_TYPES;
+  uint16_t literal_index;
+
+  if (arg_types == CBC_NO_FLAG)
+  {
+    literal_index = context_p->last_cbc.literal_index;
+  }
+  else if (arg_types == CBC_HAS_LITERAL_ARG)
+  {
+    literal_index = context_p->last_cbc.value;
+  }
+  else
+  {
+    literal_index = context_p->last_cbc.third_literal_index;
+  }
+
+  context_p->last_cbc_opcode = opcode;
+  parser_emit_cbc_literal (context_p, CBC_ASSIGN_SET_IDENT, literal_index);
+} /* parser_split_binary_to_ident */
+
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+
 /**
  * Generate byte code for operators with lvalue.
  */
 static inline void
 parser_push_result (parser_context_t *context_p) /**< context */
 {
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+  if (CBC_EXT_BINARY_TO_IDENT_OPERATION (context_p->last_cbc_opcode))
+  {
+    parser_split_binary_to_ident (context_p);
+  }
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+
   if (CBC_NO_RESULT_OPERATION (context_p->last_cbc_opcode))
   {
     JERRY_ASSERT (CBC_SAME_ARGS (context_p->last_cbc_opcode, context_p->last_cbc_opcode + 1));
@@ -2614,6 +2701,14 @@ parser_process_binary_opcodes (parser_context_t *context_p, /**< context */
 
       if (index >= 0)
       {
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+        if (opcode == CBC_ASSIGN_SET_IDENT
+            && parser_merge_binary_to_ident (context_p, (uint16_t) index))
+        {
+          continue;
+        }
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+
         if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL
             && opcode == CBC_ASSIGN_SET_IDENT)
         {
@@ -3290,6 +3385,13 @@ parser_parse_block_expression (parser_context_t *context_p, /**< context */
 {
   parser_parse_expression (context_p, options | PARSE_EXPR_NO_PUSH_RESULT);
 
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+  if (CBC_EXT_BINARY_TO_IDENT_OPERATION (context_p->last_cbc_opcode))
+  {
+    parser_split_binary_to_ident (context_p);
+  }
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+
   if (CBC_NO_RESULT_OPERATION (context_p->last_cbc_opcode))
   {
     JERRY_ASSERT (CBC_SAME_ARGS (context_p->last_cbc_opcode, context_p->last_cbc_opcode + 2));
@@ -737,6 +737,9 @@ uint8_t lexer_convert_binary_lvalue_token_to_binary (uint8_t token);
 void parser_parse_block_expression (parser_context_t *context_p, int options);
 void parser_parse_expression_statement (parser_context_t *context_p, int options);
 void parser_parse_expression (parser_context_t *context_p, int options);
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+bool parser_merge_binary_to_ident (parser_context_t *context_p, uint16_t literal_index);
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
 #if ENABLED (JERRY_ES2015)
 void parser_parse_class (parser_context_t *context_p, bool is_statement);
 void parser_parse_initializer (parser_context_t *context_p, parser_pattern_flags_t flags);
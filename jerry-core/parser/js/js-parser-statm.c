@@ -587,7 +587,15 @@ parser_parse_var_statement (parser_context_t *context_p) /**< context */
         }
 #endif /* ENABLED (JERRY_ES2015) */
 
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+        if (opcode != CBC_ASSIGN_SET_IDENT
+            || !parser_merge_binary_to_ident (context_p, index))
+        {
+          parser_emit_cbc_literal (context_p, (uint16_t) opcode, index);
+        }
+#else /* !ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
         parser_emit_cbc_literal (context_p, (uint16_t) opcode, index);
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
       }
 #if ENABLED (JERRY_ES2015)
       else if (declaration_type == LEXER_KEYW_LET)
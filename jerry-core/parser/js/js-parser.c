@@ -894,6 +894,40 @@ parser_append_breakpoint_info (parser_context_t *context_p, /**< context */
     } \
   } while (0)
 
+#if ENABLED (JERRY_VM_SUPERINSTRUCTIONS)
+
+JERRY_STATIC_ASSERT (CBC_GREATER_EQUAL_TWO_LITERALS == CBC_STRICT_EQUAL + 17,
+                     fusable_comparison_opcodes_must_be_in_consecutive_order);
+
+JERRY_STATIC_ASSERT (CBC_GREATER_EQUAL_TWO_LITERALS_AND_BRANCH == CBC_STRICT_EQUAL_AND_BRANCH + 11,
+                     compare_and_branch_opcodes_must_be_in_consecutive_order);
+
+/**
+ * Checks whether the opcode is a comparison which has a compare and branch superinstruction.
+ */
+#define PARSER_IS_FUSABLE_COMPARISON(opcode) \
+  ((opcode) >= CBC_STRICT_EQUAL \
+   && (opcode) <= CBC_GREATER_EQUAL_TWO_LITERALS \
+   && ((opcode) - CBC_STRICT_EQUAL) % 3 != CBC_BINARY_WITH_LITERAL)
+
+/**
+ * Checks whether the opcode is a conditional branch which can be executed by a superinstruction.
+ */
+#define PARSER_IS_FUSABLE_BRANCH(opcode) \
+  ((opcode) >= CBC_BRANCH_IF_TRUE_FORWARD \
+   && (opcode) <= CBC_BRANCH_IF_FALSE_BACKWARD_3 \
+   && (cbc_flags[opcode] & CBC_HAS_BRANCH_ARG))
+
+/**
+ * Get the compare and branch superinstruction of a fusable comparison.
+ */
+#define PARSER_GET_COMPARE_AND_BRANCH_OPCODE(opcode) \
+  ((uint8_t) (CBC_STRICT_EQUAL_AND_BRANCH \
+              + (((opcode) - CBC_STRICT_EQUAL) / 3) * 2 \
+              + (((opcode) - CBC_STRICT_EQUAL) % 3 == CBC_BINARY_WITH_TWO_LITERALS)))
+
+#endif /* ENABLED (JERRY_VM_SUPERINSTRUCTIONS) */
+
 /**
  * Post processing main function.
  *
@@ -1361,6 +1395,9 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   real_offset = 0;
   uint8_t last_register_index = (uint8_t) JERRY_MIN (context_p->register_count,
                                                      (PARSER_MAXIMUM_NUMBER_OF_REGISTERS - 1));
+#if ENABLED (JERRY_VM_SUPERINSTRUCTIONS)
+  uint8_t *compare_opcode_p = NULL;
+#endif /* ENABLED (JERRY_VM_SUPERINSTRUCTIONS) */
 
   while (page_p != last_page_p || offset < last_position)
   {
@@ -1395,6 +1432,17 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
     flags = cbc_flags[opcode];
 
+#if ENABLED (JERRY_VM_SUPERINSTRUCTIONS)
+    if (compare_opcode_p != NULL && PARSER_IS_FUSABLE_BRANCH (opcode))
+    {
+      /* The byte code length is unchanged, since the branch is kept after the superinstruction. */
+      *compare_opcode_p = PARSER_GET_COMPARE_AND_BRANCH_OPCODE (*compare_opcode_p);
+      JERRY_CONTEXT (status_flags) |= ECMA_STATUS_HAS_SUPERINSTRUCTIONS;
+    }
+
+    compare_opcode_p = PARSER_IS_FUSABLE_COMPARISON (opcode) ? opcode_p : NULL;
+#endif /* ENABLED (JERRY_VM_SUPERINSTRUCTIONS) */
+
 #if ENABLED (JERRY_DEBUGGER)
     if (opcode == CBC_BREAKPOINT_DISABLED)
     {
@@ -1417,6 +1465,13 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       real_offset++;
       PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
 
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+      if (CBC_EXT_BINARY_TO_IDENT_OPERATION (PARSER_TO_EXT_OPCODE (ext_opcode)))
+      {
+        JERRY_CONTEXT (status_flags) |= ECMA_STATUS_HAS_THREE_ADDRESS_OPCODES;
+      }
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+
 #if ENABLED (JERRY_LINE_INFO)
       if (ext_opcode == CBC_EXT_LINE)
       {
@@ -64,6 +64,33 @@ typedef struct vm_frame_ctx_t
   /* Registers start immediately after the frame context. */
 } vm_frame_ctx_t;
 
+#if ENABLED (JERRY_VM_DIRECT_CALLS)
+
+/**
+ * State of a direct call, which is pushed onto the VM stack before the frame of the callee
+ */
+typedef struct
+{
+  size_t prev_stack_top;                              /**< VM stack top before the call */
+  ecma_object_t *local_env_p;                         /**< lexical environment created for the call (or NULL) */
+  ecma_value_t free_this_binding;                     /**< this binding created for the call (or undefined) */
+#if ENABLED (JERRY_ES2015)
+  ecma_object_t *prev_new_target_p;                   /**< new target before the call */
+  ecma_object_t *prev_function_obj_p;                 /**< active function object before the call */
+#endif /* ENABLED (JERRY_ES2015) */
+} vm_direct_call_t;
+
+#endif /* ENABLED (JERRY_VM_DIRECT_CALLS) */
+
+#if (JERRY_VM_STACK_SIZE != 0)
+
+/**
+ * Number of words of the VM stack which holds the frames of the running functions.
+ */
+#define VM_STACK_WORD_COUNT (((size_t) JERRY_VM_STACK_SIZE * 1024) / sizeof (uintptr_t))
+
+#endif /* (JERRY_VM_STACK_SIZE != 0) */
+
 /**
  * Get register list corresponding to the frame context.
  */
@@ -145,3 +145,54 @@ vm_get_backtrace (uint32_t max_depth) /**< maximum backtrace depth, 0 = unlimite
   return ecma_op_create_array_object (NULL, 0, false);
 #endif /* ENABLED (JERRY_LINE_INFO) */
 } /* vm_get_backtrace */
+
+#if ENABLED (JERRY_VM_PROFILER)
+
+/**
+ * Pass the call stack of the running script to the profiler callback.
+ */
+void
+vm_profiler_sample (const vm_frame_ctx_t *frame_ctx_p, /**< currently executed frame */
+                    const uint8_t *byte_code_p) /**< currently executed byte code of the frame */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (vm_profile_cb) != NULL);
+
+  JERRY_CONTEXT (vm_profile_counter) = JERRY_CONTEXT (vm_profile_frequency);
+
+  jerry_vm_profile_frame_t frames[VM_PROFILER_MAX_DEPTH];
+  uint32_t frame_count = 0;
+
+  /* The frames are visited from the innermost one, so they are stored from the end. */
+  while (frame_ctx_p != NULL && frame_count < VM_PROFILER_MAX_DEPTH)
+  {
+    jerry_vm_profile_frame_t *profile_frame_p = frames + (VM_PROFILER_MAX_DEPTH - 1 - frame_count);
+
+    profile_frame_p->function_p = frame_ctx_p->bytecode_header_p;
+    profile_frame_p->byte_offset = (uint32_t) (byte_code_p - frame_ctx_p->byte_code_start_p);
+#if ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ES2015_MODULE_SYSTEM)
+    profile_frame_p->resource_name = frame_ctx_p->resource_name;
+#else /* !ENABLED (JERRY_LINE_INFO) && !ENABLED (JERRY_ES2015_MODULE_SYSTEM) */
+    profile_frame_p->resource_name = ECMA_VALUE_UNDEFINED;
+#endif /* ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ES2015_MODULE_SYSTEM) */
+#if ENABLED (JERRY_LINE_INFO)
+    profile_frame_p->line = frame_ctx_p->current_line;
+#else /* !ENABLED (JERRY_LINE_INFO) */
+    profile_frame_p->line = 0;
+#endif /* ENABLED (JERRY_LINE_INFO) */
+
+    frame_count++;
+    frame_ctx_p = frame_ctx_p->prev_context_p;
+
+    if (frame_ctx_p != NULL)
+    {
+      /* The callers are suspended at their call instructions. */
+      byte_code_p = frame_ctx_p->byte_code_p;
+    }
+  }
+
+  JERRY_CONTEXT (vm_profile_cb) (frames + (VM_PROFILER_MAX_DEPTH - frame_count),
+                                 frame_count,
+                                 JERRY_CONTEXT (vm_profile_user_p));
+} /* vm_profiler_sample */
+
+#endif /* ENABLED (JERRY_VM_PROFILER) */
@@ -25,10 +25,12 @@
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
+#include "ecma-icache.h"
 #include "ecma-iterator-object.h"
 #include "ecma-lcache.h"
 #include "ecma-lex-env.h"
 #include "ecma-objects.h"
+#include "ecma-objects-arguments.h"
 #include "ecma-objects-general.h"
 #include "ecma-regexp-object.h"
 #include "ecma-try-catch-macro.h"
@@ -59,8 +61,13 @@
  */
 static ecma_value_t
 vm_op_get_value (ecma_value_t object, /**< base object */
-                 ecma_value_t property) /**< property name */
+                 ecma_value_t property, /**< property name */
+                 const uint8_t *byte_code_p) /**< property access instruction */
 {
+#if !ENABLED (JERRY_INLINE_CACHE)
+  JERRY_UNUSED (byte_code_p);
+#endif /* !ENABLED (JERRY_INLINE_CACHE) */
+
   if (ecma_is_value_object (object))
   {
     ecma_object_t *object_p = ecma_get_object_from_value (object);
@@ -106,6 +113,16 @@ vm_op_get_value (ecma_value_t object, /**< base object */
 
     if (property_name_p != NULL)
     {
+#if ENABLED (JERRY_INLINE_CACHE)
+      ecma_property_t *cached_property_p = ecma_icache_lookup (byte_code_p, object_p, property_name_p, false);
+
+      if (cached_property_p != NULL
+          && ECMA_PROPERTY_GET_TYPE (*cached_property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+      {
+        return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (cached_property_p)->value);
+      }
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
 #if ENABLED (JERRY_LCACHE)
       ecma_property_t *property_p = ecma_lcache_lookup (object_p, property_name_p);
 
@@ -160,8 +177,13 @@ static ecma_value_t
 vm_op_set_value (ecma_value_t base, /**< base object */
                  ecma_value_t property, /**< property name */
                  ecma_value_t value, /**< ecma value */
-                 bool is_strict) /**< strict mode */
+                 bool is_strict, /**< strict mode */
+                 const uint8_t *byte_code_p) /**< property access instruction */
 {
+#if !ENABLED (JERRY_INLINE_CACHE)
+  JERRY_UNUSED (byte_code_p);
+#endif /* !ENABLED (JERRY_INLINE_CACHE) */
+
   ecma_value_t result = ECMA_VALUE_EMPTY;
   ecma_object_t *object_p;
   ecma_string_t *property_p;
@@ -234,11 +256,30 @@ vm_op_set_value (ecma_value_t base, /**< base object */
 
     if (!ecma_is_lexical_environment (object_p))
     {
+#if ENABLED (JERRY_INLINE_CACHE)
+      ecma_property_t *cached_property_p = ecma_icache_lookup (byte_code_p, object_p, property_p, true);
+
+      if (cached_property_p != NULL
+          && ECMA_PROPERTY_GET_TYPE (*cached_property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+          && ecma_is_property_writable (*cached_property_p))
+      {
+        ecma_named_data_property_assign_value (object_p, ECMA_PROPERTY_VALUE_PTR (cached_property_p), value);
+      }
+      else
+      {
+        result = ecma_op_object_put_with_receiver (object_p,
+                                                   property_p,
+                                                   value,
+                                                   base,
+                                                   is_strict);
+      }
+#else /* !ENABLED (JERRY_INLINE_CACHE) */
       result = ecma_op_object_put_with_receiver (object_p,
                                                  property_p,
                                                  value,
                                                  base,
                                                  is_strict);
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
     }
     else
     {
@@ -745,51 +786,43 @@ vm_spread_operation (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 #endif /* ENABLED (JERRY_ES2015) */
 
 /**
- * 'Function call' opcode handler.
+ * Decode the arguments of a function call opcode.
  *
- * See also: ECMA-262 v5, 11.2.3
+ * @return pointer to the byte code after the opcode
  */
-static void
-opfunc_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+static inline const uint8_t * JERRY_ATTR_ALWAYS_INLINE
+vm_decode_call (const vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                uint32_t *arguments_list_len_p, /**< [out] number of arguments */
+                bool *is_call_prop_p) /**< [out] true - if the call has a this value */
 {
   const uint8_t *byte_code_p = frame_ctx_p->byte_code_p + 1;
   uint8_t opcode = byte_code_p[-1];
-  uint32_t arguments_list_len;
 
   if (opcode >= CBC_CALL0)
   {
-    arguments_list_len = (unsigned int) ((opcode - CBC_CALL0) / 6);
+    *arguments_list_len_p = (unsigned int) ((opcode - CBC_CALL0) / 6);
   }
   else
   {
-    arguments_list_len = *byte_code_p++;
+    *arguments_list_len_p = *byte_code_p++;
   }
 
-  bool is_call_prop = ((opcode - CBC_CALL) % 6) >= 3;
+  *is_call_prop_p = ((opcode - CBC_CALL) % 6) >= 3;
+  return byte_code_p;
+} /* vm_decode_call */
 
+/**
+ * Free the operands of a function call opcode and put the result of the call.
+ */
+static void
+vm_complete_call (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                  ecma_value_t completion_value) /**< result of the call */
+{
+  uint32_t arguments_list_len;
+  bool is_call_prop;
+  const uint8_t *byte_code_p = vm_decode_call (frame_ctx_p, &arguments_list_len, &is_call_prop);
+  uint8_t opcode = frame_ctx_p->byte_code_p[0];
   ecma_value_t *stack_top_p = frame_ctx_p->stack_top_p - arguments_list_len;
-  ecma_value_t this_value = is_call_prop ? stack_top_p[-3] : ECMA_VALUE_UNDEFINED;
-  ecma_value_t func_value = stack_top_p[-1];
-  ecma_value_t completion_value;
-
-#if defined(JERRY_FUNCTION_BACKTRACE) && !defined(__APPLE__)
-  frame_ctx_p->callee_value = func_value;
-#endif
-
-  if (!ecma_is_value_object (func_value)
-      || !ecma_op_object_is_callable (ecma_get_object_from_value (func_value)))
-  {
-    completion_value = ecma_raise_type_error (ECMA_ERR_MSG ("Expected a function."));
-  }
-  else
-  {
-    ecma_object_t *func_obj_p = ecma_get_object_from_value (func_value);
-
-    completion_value = ecma_op_function_call (func_obj_p,
-                                              this_value,
-                                              stack_top_p,
-                                              arguments_list_len);
-  }
 
   JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_DIRECT_EVAL;
 
@@ -834,6 +867,45 @@ opfunc_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   }
 
   frame_ctx_p->stack_top_p = stack_top_p;
+} /* vm_complete_call */
+
+/**
+ * 'Function call' opcode handler.
+ *
+ * See also: ECMA-262 v5, 11.2.3
+ */
+static void
+opfunc_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  uint32_t arguments_list_len;
+  bool is_call_prop;
+  vm_decode_call (frame_ctx_p, &arguments_list_len, &is_call_prop);
+
+  ecma_value_t *stack_top_p = frame_ctx_p->stack_top_p - arguments_list_len;
+  ecma_value_t this_value = is_call_prop ? stack_top_p[-3] : ECMA_VALUE_UNDEFINED;
+  ecma_value_t func_value = stack_top_p[-1];
+  ecma_value_t completion_value;
+
+#if defined(JERRY_FUNCTION_BACKTRACE) && !defined(__APPLE__)
+  frame_ctx_p->callee_value = func_value;
+#endif
+
+  if (!ecma_is_value_object (func_value)
+      || !ecma_op_object_is_callable (ecma_get_object_from_value (func_value)))
+  {
+    completion_value = ecma_raise_type_error (ECMA_ERR_MSG ("Expected a function."));
+  }
+  else
+  {
+    ecma_object_t *func_obj_p = ecma_get_object_from_value (func_value);
+
+    completion_value = ecma_op_function_call (func_obj_p,
+                                              this_value,
+                                              stack_top_p,
+                                              arguments_list_len);
+  }
+
+  vm_complete_call (frame_ctx_p, completion_value);
 } /* opfunc_call */
 
 /**
@@ -966,6 +1038,118 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   } \
   while (0)
 
+#if ENABLED (JERRY_VM_COMPUTED_GOTO)
+
+/**
+ * Case label of an opcode group handler, which also defines the jump target of the handler.
+ */
+#define VM_CASE(group) case group: vm_oc_label_ ## group
+
+/**
+ * Dispatch table entry of an opcode group.
+ */
+#define VM_DISPATCH_ENTRY(group) [group] = __extension__ &&vm_oc_label_ ## group
+
+/**
+ * Jump to the handler of the current opcode group.
+ *
+ * Note:
+ *      each operand decoder has its own copy of this indirect jump
+ */
+#define VM_DISPATCH_GROUP() VM_DISPATCH (vm_dispatch_table[VM_OC_GROUP_GET_INDEX (opcode_data)])
+
+/**
+ * Entry point of an operand decoder.
+ */
+#define VM_DECODER(name) name: operands = VM_OC_GET_ARGS_INDEX (opcode_data)
+
+/**
+ * Operand decoder of an opcode.
+ */
+#define VM_DECODER_ADDRESS(opcode_data) \
+  (VM_OC_GET_ARGS_INDEX (opcode_data) >= VM_OC_GET_LITERAL ? __extension__ &&vm_decode_literal \
+   : VM_OC_GET_ARGS_INDEX (opcode_data) >= VM_OC_GET_STACK ? __extension__ &&vm_decode_stack \
+   : VM_OC_GET_ARGS_INDEX (opcode_data) == VM_OC_GET_BRANCH ? __extension__ &&vm_decode_branch \
+   : __extension__ &&vm_decode_none)
+
+/**
+ * Indirect jump to a label address.
+ */
+#define VM_DISPATCH(address) \
+  _Pragma ("GCC diagnostic push") \
+  _Pragma ("GCC diagnostic ignored \"-Wpedantic\"") \
+  goto *(address); \
+  _Pragma ("GCC diagnostic pop")
+
+#else /* !ENABLED (JERRY_VM_COMPUTED_GOTO) */
+
+/**
+ * Case label of an opcode group handler.
+ */
+#define VM_CASE(group) case group
+
+/**
+ * The opcode group is selected by the switch statement.
+ */
+#define VM_DISPATCH_GROUP()
+
+/**
+ * The operand decoders are selected by conditional branches.
+ */
+#define VM_DECODER(name)
+
+#endif /* ENABLED (JERRY_VM_COMPUTED_GOTO) */
+
+#if ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES)
+
+/**
+ * Checks whether the result of a binary opcode is assigned to an identifier.
+ */
+#define VM_HAS_BINARY_IDENT_RESULT(opcode_data) ((opcode_data) & VM_OC_PUT_IDENT)
+
+#else /* !ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+
+/**
+ * Binary opcodes always push their result.
+ */
+#define VM_HAS_BINARY_IDENT_RESULT(opcode_data) false
+
+#endif /* ENABLED (JERRY_VM_THREE_ADDRESS_OPCODES) */
+
+/**
+ * Push the result of a binary opcode whose operands are already released,
+ * or assign it to the identifier of its three-address form.
+ */
+#define VM_PUSH_BINARY_VALUE(value) \
+  do \
+  { \
+    result = (value); \
+    if (VM_HAS_BINARY_IDENT_RESULT (opcode_data)) \
+    { \
+      left_value = ECMA_VALUE_UNDEFINED; \
+      right_value = ECMA_VALUE_UNDEFINED; \
+      goto put_result; \
+    } \
+    *stack_top_p++ = result; \
+  } \
+  while (0)
+
+/**
+ * Push the result of a binary opcode and release its operands,
+ * or assign it to the identifier of its three-address form.
+ */
+#define VM_PUSH_BINARY_RESULT() \
+  do \
+  { \
+    if (VM_HAS_BINARY_IDENT_RESULT (opcode_data)) \
+    { \
+      goto put_result; \
+    } \
+    *stack_top_p++ = result; \
+    goto free_both_values; \
+  } \
+  while (0)
+
 /**
  * Run generic byte code.
  *
@@ -991,6 +1175,194 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   ecma_value_t result = ECMA_VALUE_EMPTY;
   bool is_strict = ((frame_ctx_p->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0);
 
+#if ENABLED (JERRY_VM_COMPUTED_GOTO)
+  /* Handler addresses of the opcode groups. The entries follow the definition of vm_oc_types. */
+  static const void *const vm_dispatch_table[VM_OC_NONE + 1] =
+  {
+    VM_DISPATCH_ENTRY (VM_OC_POP),
+    VM_DISPATCH_ENTRY (VM_OC_POP_BLOCK),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_TWO),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_THREE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_UNDEFINED),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_TRUE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_FALSE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_NULL),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_THIS),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_0),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_POS_BYTE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_NEG_BYTE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_LIT_0),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_LIT_POS_BYTE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_LIT_NEG_BYTE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_OBJECT),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_NAMED_FUNC_EXPR),
+    VM_DISPATCH_ENTRY (VM_OC_SET_PROPERTY),
+    VM_DISPATCH_ENTRY (VM_OC_SET_GETTER),
+    VM_DISPATCH_ENTRY (VM_OC_SET_SETTER),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_ARRAY),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_ELISON),
+    VM_DISPATCH_ENTRY (VM_OC_APPEND_ARRAY),
+    VM_DISPATCH_ENTRY (VM_OC_IDENT_REFERENCE),
+    VM_DISPATCH_ENTRY (VM_OC_PROP_REFERENCE),
+    VM_DISPATCH_ENTRY (VM_OC_PROP_GET),
+    VM_DISPATCH_ENTRY (VM_OC_PROP_PRE_INCR),
+    VM_DISPATCH_ENTRY (VM_OC_PROP_PRE_DECR),
+    VM_DISPATCH_ENTRY (VM_OC_PROP_POST_INCR),
+    VM_DISPATCH_ENTRY (VM_OC_PROP_POST_DECR),
+    VM_DISPATCH_ENTRY (VM_OC_PRE_INCR),
+    VM_DISPATCH_ENTRY (VM_OC_PRE_DECR),
+    VM_DISPATCH_ENTRY (VM_OC_POST_INCR),
+    VM_DISPATCH_ENTRY (VM_OC_POST_DECR),
+    VM_DISPATCH_ENTRY (VM_OC_PROP_DELETE),
+    VM_DISPATCH_ENTRY (VM_OC_DELETE),
+    VM_DISPATCH_ENTRY (VM_OC_MOV_IDENT),
+    VM_DISPATCH_ENTRY (VM_OC_ASSIGN),
+    VM_DISPATCH_ENTRY (VM_OC_ASSIGN_PROP),
+    VM_DISPATCH_ENTRY (VM_OC_ASSIGN_PROP_THIS),
+    VM_DISPATCH_ENTRY (VM_OC_RETURN),
+    VM_DISPATCH_ENTRY (VM_OC_THROW),
+    VM_DISPATCH_ENTRY (VM_OC_THROW_REFERENCE_ERROR),
+    VM_DISPATCH_ENTRY (VM_OC_EVAL),
+    VM_DISPATCH_ENTRY (VM_OC_CALL),
+    VM_DISPATCH_ENTRY (VM_OC_NEW),
+    VM_DISPATCH_ENTRY (VM_OC_RESOLVE_BASE_FOR_CALL),
+    VM_DISPATCH_ENTRY (VM_OC_ERROR),
+    VM_DISPATCH_ENTRY (VM_OC_JUMP),
+    VM_DISPATCH_ENTRY (VM_OC_BRANCH_IF_STRICT_EQUAL),
+    VM_DISPATCH_ENTRY (VM_OC_BRANCH_IF_TRUE),
+    VM_DISPATCH_ENTRY (VM_OC_BRANCH_IF_FALSE),
+    VM_DISPATCH_ENTRY (VM_OC_BRANCH_IF_LOGICAL_TRUE),
+    VM_DISPATCH_ENTRY (VM_OC_BRANCH_IF_LOGICAL_FALSE),
+    VM_DISPATCH_ENTRY (VM_OC_PLUS),
+    VM_DISPATCH_ENTRY (VM_OC_MINUS),
+    VM_DISPATCH_ENTRY (VM_OC_NOT),
+    VM_DISPATCH_ENTRY (VM_OC_BIT_NOT),
+    VM_DISPATCH_ENTRY (VM_OC_VOID),
+    VM_DISPATCH_ENTRY (VM_OC_TYPEOF_IDENT),
+    VM_DISPATCH_ENTRY (VM_OC_TYPEOF),
+    VM_DISPATCH_ENTRY (VM_OC_ADD),
+    VM_DISPATCH_ENTRY (VM_OC_SUB),
+    VM_DISPATCH_ENTRY (VM_OC_MUL),
+    VM_DISPATCH_ENTRY (VM_OC_DIV),
+    VM_DISPATCH_ENTRY (VM_OC_MOD),
+#if ENABLED (JERRY_ES2015)
+    VM_DISPATCH_ENTRY (VM_OC_EXP),
+#endif /* ENABLED (JERRY_ES2015) */
+    VM_DISPATCH_ENTRY (VM_OC_EQUAL),
+    VM_DISPATCH_ENTRY (VM_OC_NOT_EQUAL),
+    VM_DISPATCH_ENTRY (VM_OC_STRICT_EQUAL),
+    VM_DISPATCH_ENTRY (VM_OC_STRICT_NOT_EQUAL),
+    VM_DISPATCH_ENTRY (VM_OC_LESS),
+    VM_DISPATCH_ENTRY (VM_OC_GREATER),
+    VM_DISPATCH_ENTRY (VM_OC_LESS_EQUAL),
+    VM_DISPATCH_ENTRY (VM_OC_GREATER_EQUAL),
+    VM_DISPATCH_ENTRY (VM_OC_IN),
+    VM_DISPATCH_ENTRY (VM_OC_INSTANCEOF),
+#if ENABLED (JERRY_VM_SUPERINSTRUCTIONS)
+    VM_DISPATCH_ENTRY (VM_OC_STRICT_EQUAL_AND_BRANCH),
+    VM_DISPATCH_ENTRY (VM_OC_STRICT_NOT_EQUAL_AND_BRANCH),
+    VM_DISPATCH_ENTRY (VM_OC_LESS_AND_BRANCH),
+    VM_DISPATCH_ENTRY (VM_OC_GREATER_AND_BRANCH),
+    VM_DISPATCH_ENTRY (VM_OC_LESS_EQUAL_AND_BRANCH),
+    VM_DISPATCH_ENTRY (VM_OC_GREATER_EQUAL_AND_BRANCH),
+#endif /* ENABLED (JERRY_VM_SUPERINSTRUCTIONS) */
+    VM_DISPATCH_ENTRY (VM_OC_BIT_OR),
+    VM_DISPATCH_ENTRY (VM_OC_BIT_XOR),
+    VM_DISPATCH_ENTRY (VM_OC_BIT_AND),
+    VM_DISPATCH_ENTRY (VM_OC_LEFT_SHIFT),
+    VM_DISPATCH_ENTRY (VM_OC_RIGHT_SHIFT),
+    VM_DISPATCH_ENTRY (VM_OC_UNS_RIGHT_SHIFT),
+    VM_DISPATCH_ENTRY (VM_OC_BLOCK_CREATE_CONTEXT),
+    VM_DISPATCH_ENTRY (VM_OC_WITH),
+    VM_DISPATCH_ENTRY (VM_OC_FOR_IN_CREATE_CONTEXT),
+    VM_DISPATCH_ENTRY (VM_OC_FOR_IN_GET_NEXT),
+    VM_DISPATCH_ENTRY (VM_OC_FOR_IN_HAS_NEXT),
+    VM_DISPATCH_ENTRY (VM_OC_TRY),
+    VM_DISPATCH_ENTRY (VM_OC_CATCH),
+    VM_DISPATCH_ENTRY (VM_OC_FINALLY),
+    VM_DISPATCH_ENTRY (VM_OC_CONTEXT_END),
+    VM_DISPATCH_ENTRY (VM_OC_JUMP_AND_EXIT_CONTEXT),
+    VM_DISPATCH_ENTRY (VM_OC_CREATE_BINDING),
+    VM_DISPATCH_ENTRY (VM_OC_SET_BYTECODE_PTR),
+    VM_DISPATCH_ENTRY (VM_OC_VAR_EVAL),
+#if ENABLED (JERRY_ES2015)
+    VM_DISPATCH_ENTRY (VM_OC_EXT_VAR_EVAL),
+#endif /* ENABLED (JERRY_ES2015) */
+    VM_DISPATCH_ENTRY (VM_OC_INIT_ARG_OR_FUNC),
+#if ENABLED (JERRY_DEBUGGER)
+    VM_DISPATCH_ENTRY (VM_OC_BREAKPOINT_ENABLED),
+    VM_DISPATCH_ENTRY (VM_OC_BREAKPOINT_DISABLED),
+#endif /* ENABLED (JERRY_DEBUGGER) */
+#if ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ES2015_MODULE_SYSTEM)
+    VM_DISPATCH_ENTRY (VM_OC_RESOURCE_NAME),
+#endif /* ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ES2015_MODULE_SYSTEM) */
+#if ENABLED (JERRY_LINE_INFO)
+    VM_DISPATCH_ENTRY (VM_OC_LINE),
+#endif /* ENABLED (JERRY_LINE_INFO) */
+#if ENABLED (JERRY_ES2015)
+    VM_DISPATCH_ENTRY (VM_OC_CHECK_VAR),
+    VM_DISPATCH_ENTRY (VM_OC_CHECK_LET),
+    VM_DISPATCH_ENTRY (VM_OC_ASSIGN_LET_CONST),
+    VM_DISPATCH_ENTRY (VM_OC_INIT_BINDING),
+    VM_DISPATCH_ENTRY (VM_OC_THROW_CONST_ERROR),
+    VM_DISPATCH_ENTRY (VM_OC_COPY_TO_GLOBAL),
+    VM_DISPATCH_ENTRY (VM_OC_COPY_FROM_ARG),
+    VM_DISPATCH_ENTRY (VM_OC_CLONE_CONTEXT),
+    VM_DISPATCH_ENTRY (VM_OC_SET_COMPUTED_PROPERTY),
+    VM_DISPATCH_ENTRY (VM_OC_FOR_OF_CREATE_CONTEXT),
+    VM_DISPATCH_ENTRY (VM_OC_FOR_OF_GET_NEXT),
+    VM_DISPATCH_ENTRY (VM_OC_FOR_OF_HAS_NEXT),
+    VM_DISPATCH_ENTRY (VM_OC_LOCAL_EVAL),
+    VM_DISPATCH_ENTRY (VM_OC_SUPER_CALL),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_CLASS_ENVIRONMENT),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_IMPLICIT_CTOR),
+    VM_DISPATCH_ENTRY (VM_OC_INIT_CLASS),
+    VM_DISPATCH_ENTRY (VM_OC_FINALIZE_CLASS),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_SUPER_CONSTRUCTOR),
+    VM_DISPATCH_ENTRY (VM_OC_RESOLVE_LEXICAL_THIS),
+    VM_DISPATCH_ENTRY (VM_OC_SUPER_REFERENCE),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_SPREAD_ELEMENT),
+    VM_DISPATCH_ENTRY (VM_OC_GET_ITERATOR),
+    VM_DISPATCH_ENTRY (VM_OC_ITERATOR_STEP),
+    VM_DISPATCH_ENTRY (VM_OC_ITERATOR_CLOSE),
+    VM_DISPATCH_ENTRY (VM_OC_DEFAULT_INITIALIZER),
+    VM_DISPATCH_ENTRY (VM_OC_REST_INITIALIZER),
+    VM_DISPATCH_ENTRY (VM_OC_INITIALIZER_PUSH_PROP),
+    VM_DISPATCH_ENTRY (VM_OC_SPREAD_ARGUMENTS),
+    VM_DISPATCH_ENTRY (VM_OC_CREATE_GENERATOR),
+    VM_DISPATCH_ENTRY (VM_OC_YIELD),
+    VM_DISPATCH_ENTRY (VM_OC_AWAIT),
+    VM_DISPATCH_ENTRY (VM_OC_EXT_RETURN),
+    VM_DISPATCH_ENTRY (VM_OC_RETURN_PROMISE),
+    VM_DISPATCH_ENTRY (VM_OC_STRING_CONCAT),
+    VM_DISPATCH_ENTRY (VM_OC_GET_TEMPLATE_OBJECT),
+    VM_DISPATCH_ENTRY (VM_OC_PUSH_NEW_TARGET),
+    VM_DISPATCH_ENTRY (VM_OC_REQUIRE_OBJECT_COERCIBLE),
+    VM_DISPATCH_ENTRY (VM_OC_ASSIGN_SUPER),
+    VM_DISPATCH_ENTRY (VM_OC_SET__PROTO__),
+#endif /* ENABLED (JERRY_ES2015) */
+    VM_DISPATCH_ENTRY (VM_OC_NONE)
+  };
+
+  /* Operand decoders of the opcodes and the extended opcodes. The extended opcode prefix
+   * reads the second byte instead, so it needs no extra branch before the dispatch. */
+#define CBC_OPCODE(arg1, arg2, arg3, arg4) \
+  ((arg1) == CBC_EXT_OPCODE ? __extension__ &&vm_decode_ext_opcode : VM_DECODER_ADDRESS (arg4)),
+  static const void *const vm_opcode_table[] =
+  {
+    CBC_OPCODE_LIST
+#undef CBC_OPCODE
+#define CBC_OPCODE(arg1, arg2, arg3, arg4) VM_DECODER_ADDRESS (arg4),
+    CBC_EXT_OPCODE_LIST
+  };
+#undef CBC_OPCODE
+
+  JERRY_STATIC_ASSERT (sizeof (vm_opcode_table) / sizeof (vm_opcode_table[0]) == sizeof (vm_decode_table)
+                       / sizeof (vm_decode_table[0]),
+                       vm_opcode_table_must_have_an_entry_for_each_decode_table_entry);
+#endif /* ENABLED (JERRY_VM_COMPUTED_GOTO) */
+
   /* Prepare for byte code execution. */
   if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_FULL_LITERAL_ENCODING))
   {
@@ -1030,6 +1402,24 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       uint8_t opcode = *byte_code_p++;
       uint32_t opcode_data = opcode;
 
+#if ENABLED (JERRY_VM_COMPUTED_GOTO)
+      /* The dispatch of the next opcode is kept short, so the compiler can copy it to the end
+       * of the opcode handlers. The operand decoders compute the operand types themselves. */
+      opcode_data = vm_decode_table[opcode];
+
+      left_value = ECMA_VALUE_UNDEFINED;
+      right_value = ECMA_VALUE_UNDEFINED;
+
+      uint32_t operands;
+
+      VM_DISPATCH (vm_opcode_table[opcode]);
+
+vm_decode_ext_opcode:
+      opcode = *byte_code_p++;
+      opcode_data = vm_decode_table[(CBC_END + 1) + opcode];
+
+      VM_DISPATCH (vm_opcode_table[(CBC_END + 1) + opcode]);
+#else /* !ENABLED (JERRY_VM_COMPUTED_GOTO) */
       if (opcode == CBC_EXT_OPCODE)
       {
         opcode = *byte_code_p++;
@@ -1042,9 +1432,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       right_value = ECMA_VALUE_UNDEFINED;
 
       uint32_t operands = VM_OC_GET_ARGS_INDEX (opcode_data);
+#endif /* ENABLED (JERRY_VM_COMPUTED_GOTO) */
 
       if (operands >= VM_OC_GET_LITERAL)
       {
+        VM_DECODER (vm_decode_literal);
         uint16_t literal_index;
         READ_LITERAL_INDEX (literal_index);
         READ_LITERAL (literal_index, left_value);
@@ -1077,9 +1469,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             }
           }
         }
+
+        VM_DISPATCH_GROUP ();
       }
       else if (operands >= VM_OC_GET_STACK)
       {
+        VM_DECODER (vm_decode_stack);
         JERRY_ASSERT (operands == VM_OC_GET_STACK
                       || operands == VM_OC_GET_STACK_STACK);
 
@@ -1092,9 +1487,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           right_value = left_value;
           left_value = *(--stack_top_p);
         }
+
+        VM_DISPATCH_GROUP ();
       }
       else if (operands == VM_OC_GET_BRANCH)
       {
+        VM_DECODER (vm_decode_branch);
         branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
         JERRY_ASSERT (branch_offset_length >= 1 && branch_offset_length <= 3);
 
@@ -1114,6 +1512,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
         if (opcode_data & VM_OC_BACKWARD_BRANCH)
         {
+#if ENABLED (JERRY_VM_PROFILER)
+          VM_PROFILER_TICK (frame_ctx_p, byte_code_start_p);
+#endif /* ENABLED (JERRY_VM_PROFILER) */
+
 #if ENABLED (JERRY_VM_EXEC_STOP)
           if (JERRY_CONTEXT (vm_exec_stop_cb) != NULL
               && --JERRY_CONTEXT (vm_exec_stop_counter) == 0)
@@ -1147,34 +1549,39 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           branch_offset = -branch_offset;
         }
+
+        VM_DISPATCH_GROUP ();
       }
 
+      VM_DECODER (vm_decode_none);
+      VM_DISPATCH_GROUP ();
+
       switch (VM_OC_GROUP_GET_INDEX (opcode_data))
       {
-        case VM_OC_POP:
+        VM_CASE (VM_OC_POP):
         {
           JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
           ecma_free_value (*(--stack_top_p));
           continue;
         }
-        case VM_OC_POP_BLOCK:
+        VM_CASE (VM_OC_POP_BLOCK):
         {
           ecma_fast_free_value (frame_ctx_p->block_result);
           frame_ctx_p->block_result = *(--stack_top_p);
           continue;
         }
-        case VM_OC_PUSH:
+        VM_CASE (VM_OC_PUSH):
         {
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_PUSH_TWO:
+        VM_CASE (VM_OC_PUSH_TWO):
         {
           *stack_top_p++ = left_value;
           *stack_top_p++ = right_value;
           continue;
         }
-        case VM_OC_PUSH_THREE:
+        VM_CASE (VM_OC_PUSH_THREE):
         {
           uint16_t literal_index;
 
@@ -1188,56 +1595,56 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_PUSH_UNDEFINED:
+        VM_CASE (VM_OC_PUSH_UNDEFINED):
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
           continue;
         }
-        case VM_OC_PUSH_TRUE:
+        VM_CASE (VM_OC_PUSH_TRUE):
         {
           *stack_top_p++ = ECMA_VALUE_TRUE;
           continue;
         }
-        case VM_OC_PUSH_FALSE:
+        VM_CASE (VM_OC_PUSH_FALSE):
         {
           *stack_top_p++ = ECMA_VALUE_FALSE;
           continue;
         }
-        case VM_OC_PUSH_NULL:
+        VM_CASE (VM_OC_PUSH_NULL):
         {
           *stack_top_p++ = ECMA_VALUE_NULL;
           continue;
         }
-        case VM_OC_PUSH_THIS:
+        VM_CASE (VM_OC_PUSH_THIS):
         {
           *stack_top_p++ = ecma_copy_value (frame_ctx_p->this_binding);
           continue;
         }
-        case VM_OC_PUSH_0:
+        VM_CASE (VM_OC_PUSH_0):
         {
           *stack_top_p++ = ecma_make_integer_value (0);
           continue;
         }
-        case VM_OC_PUSH_POS_BYTE:
+        VM_CASE (VM_OC_PUSH_POS_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (number + 1);
           continue;
         }
-        case VM_OC_PUSH_NEG_BYTE:
+        VM_CASE (VM_OC_PUSH_NEG_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (-(number + 1));
           continue;
         }
-        case VM_OC_PUSH_LIT_0:
+        VM_CASE (VM_OC_PUSH_LIT_0):
         {
           stack_top_p[0] = left_value;
           stack_top_p[1] = ecma_make_integer_value (0);
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_LIT_POS_BYTE:
+        VM_CASE (VM_OC_PUSH_LIT_POS_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           stack_top_p[0] = left_value;
@@ -1245,7 +1652,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_LIT_NEG_BYTE:
+        VM_CASE (VM_OC_PUSH_LIT_NEG_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           stack_top_p[0] = left_value;
@@ -1253,7 +1660,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_OBJECT:
+        VM_CASE (VM_OC_PUSH_OBJECT):
         {
           ecma_object_t *obj_p = ecma_create_object (ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE),
                                                      0,
@@ -1262,7 +1669,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_object_value (obj_p);
           continue;
         }
-        case VM_OC_PUSH_NAMED_FUNC_EXPR:
+        VM_CASE (VM_OC_PUSH_NAMED_FUNC_EXPR):
         {
           ecma_object_t *func_p = ecma_get_object_from_value (left_value);
 
@@ -1284,7 +1691,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_CREATE_BINDING:
+        VM_CASE (VM_OC_CREATE_BINDING):
         {
 #if !ENABLED (JERRY_ES2015)
           JERRY_ASSERT (opcode == CBC_CREATE_VAR);
@@ -1324,7 +1731,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_VAR_EVAL:
+        VM_CASE (VM_OC_VAR_EVAL):
         {
           uint32_t literal_index;
           ecma_value_t lit_value = ECMA_VALUE_UNDEFINED;
@@ -1389,7 +1796,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if ENABLED (JERRY_ES2015)
-        case VM_OC_EXT_VAR_EVAL:
+        VM_CASE (VM_OC_EXT_VAR_EVAL):
         {
           uint32_t literal_index;
           ecma_value_t lit_value = ECMA_VALUE_UNDEFINED;
@@ -1465,14 +1872,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
 #endif /* ENABLED (JERRY_ES2015) */
 #if ENABLED (JERRY_SNAPSHOT_EXEC)
-        case VM_OC_SET_BYTECODE_PTR:
+        VM_CASE (VM_OC_SET_BYTECODE_PTR):
         {
           memcpy (&byte_code_p, byte_code_p++, sizeof (uint8_t *));
           frame_ctx_p->byte_code_start_p = byte_code_p;
           continue;
         }
 #endif /* ENABLED (JERRY_SNAPSHOT_EXEC) */
-        case VM_OC_INIT_ARG_OR_FUNC:
+        VM_CASE (VM_OC_INIT_ARG_OR_FUNC):
         {
           uint32_t literal_index, value_index;
           ecma_value_t lit_value;
@@ -1536,7 +1943,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if ENABLED (JERRY_ES2015)
-        case VM_OC_CHECK_VAR:
+        VM_CASE (VM_OC_CHECK_VAR):
         {
           JERRY_ASSERT (ecma_get_global_scope () == frame_ctx_p->lex_env_p);
 
@@ -1559,7 +1966,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_CHECK_LET:
+        VM_CASE (VM_OC_CHECK_LET):
         {
           JERRY_ASSERT (ecma_get_global_scope () == frame_ctx_p->lex_env_p);
 
@@ -1601,7 +2008,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_ASSIGN_LET_CONST:
+        VM_CASE (VM_OC_ASSIGN_LET_CONST):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1624,7 +2031,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_INIT_BINDING:
+        VM_CASE (VM_OC_INIT_BINDING):
         {
           uint32_t literal_index;
 
@@ -1662,12 +2069,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_deref_if_object (value);
           continue;
         }
-        case VM_OC_THROW_CONST_ERROR:
+        VM_CASE (VM_OC_THROW_CONST_ERROR):
         {
           result = ecma_raise_type_error (ECMA_ERR_MSG ("Constant bindings cannot be reassigned."));
           goto error;
         }
-        case VM_OC_COPY_TO_GLOBAL:
+        VM_CASE (VM_OC_COPY_TO_GLOBAL):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1724,7 +2131,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_COPY_FROM_ARG:
+        VM_CASE (VM_OC_COPY_FROM_ARG):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1750,10 +2157,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (property_p != NULL);
 
           ecma_property_value_t *arg_prop_value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
+          ECMA_GC_WRITE_BARRIER (lex_env_p, arg_prop_value_p->value);
           property_value_p->value = ecma_copy_value_if_not_object (arg_prop_value_p->value);
           continue;
         }
-        case VM_OC_CLONE_CONTEXT:
+        VM_CASE (VM_OC_CLONE_CONTEXT):
         {
           JERRY_ASSERT (byte_code_start_p[0] == CBC_EXT_OPCODE);
 
@@ -1761,7 +2169,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->lex_env_p = ecma_clone_decl_lexical_environment (frame_ctx_p->lex_env_p, copy_values);
           continue;
         }
-        case VM_OC_SET__PROTO__:
+        VM_CASE (VM_OC_SET__PROTO__):
         {
           result = ecma_builtin_object_object_set_proto (stack_top_p[-1], left_value);
           if (ECMA_IS_VALUE_ERROR (result))
@@ -1770,7 +2178,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_SET_COMPUTED_PROPERTY:
+        VM_CASE (VM_OC_SET_COMPUTED_PROPERTY):
         {
           /* Swap values. */
           left_value ^= right_value;
@@ -1779,7 +2187,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           /* FALLTHRU */
         }
 #endif /* ENABLED (JERRY_ES2015) */
-        case VM_OC_SET_PROPERTY:
+        VM_CASE (VM_OC_SET_PROPERTY):
         {
           JERRY_STATIC_ASSERT (VM_OC_NON_STATIC_FLAG == VM_OC_BACKWARD_BRANCH,
                                vm_oc_non_static_flag_must_be_equal_to_vm_oc_backward_branch);
@@ -1856,8 +2264,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_SET_GETTER:
-        case VM_OC_SET_SETTER:
+        VM_CASE (VM_OC_SET_GETTER):
+        VM_CASE (VM_OC_SET_SETTER):
         {
           JERRY_ASSERT ((opcode_data >> VM_OC_NON_STATIC_SHIFT) <= 0x1);
 
@@ -1891,21 +2299,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_PUSH_ARRAY:
+        VM_CASE (VM_OC_PUSH_ARRAY):
         {
           // Note: this operation cannot throw an exception
           *stack_top_p++ = ecma_make_object_value (ecma_op_new_fast_array_object (0));
           continue;
         }
 #if ENABLED (JERRY_ES2015)
-        case VM_OC_LOCAL_EVAL:
+        VM_CASE (VM_OC_LOCAL_EVAL):
         {
           ECMA_CLEAR_LOCAL_PARSE_OPTS ();
           uint8_t parse_opts = *byte_code_p++;
           ECMA_SET_LOCAL_PARSE_OPTS (parse_opts);
           continue;
         }
-        case VM_OC_SUPER_CALL:
+        VM_CASE (VM_OC_SUPER_CALL):
         {
           uint8_t arguments_list_len = *byte_code_p++;
 
@@ -1933,17 +2341,17 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_PUSH_CLASS_ENVIRONMENT:
+        VM_CASE (VM_OC_PUSH_CLASS_ENVIRONMENT):
         {
           opfunc_push_class_environment (frame_ctx_p, &stack_top_p, left_value);
           goto free_left_value;
         }
-        case VM_OC_PUSH_IMPLICIT_CTOR:
+        VM_CASE (VM_OC_PUSH_IMPLICIT_CTOR):
         {
           *stack_top_p++ = opfunc_create_implicit_class_constructor (opcode);
           continue;
         }
-        case VM_OC_INIT_CLASS:
+        VM_CASE (VM_OC_INIT_CLASS):
         {
           result = opfunc_init_class (frame_ctx_p, stack_top_p);
 
@@ -1953,12 +2361,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_FINALIZE_CLASS:
+        VM_CASE (VM_OC_FINALIZE_CLASS):
         {
           opfunc_finalize_class (frame_ctx_p, &stack_top_p, left_value);
           goto free_left_value;
         }
-        case VM_OC_PUSH_SUPER_CONSTRUCTOR:
+        VM_CASE (VM_OC_PUSH_SUPER_CONSTRUCTOR):
         {
           result = ecma_op_function_get_super_constructor (JERRY_CONTEXT (current_function_obj_p));
 
@@ -1970,7 +2378,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_RESOLVE_LEXICAL_THIS:
+        VM_CASE (VM_OC_RESOLVE_LEXICAL_THIS):
         {
           result = ecma_op_get_this_binding (frame_ctx_p->lex_env_p);
 
@@ -1982,7 +2390,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_SUPER_REFERENCE:
+        VM_CASE (VM_OC_SUPER_REFERENCE):
         {
           result = opfunc_form_super_reference (&stack_top_p, frame_ctx_p, left_value, opcode);
 
@@ -1993,12 +2401,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_PUSH_SPREAD_ELEMENT:
+        VM_CASE (VM_OC_PUSH_SPREAD_ELEMENT):
         {
           *stack_top_p++ = ECMA_VALUE_SPREAD_ELEMENT;
           continue;
         }
-        case VM_OC_GET_ITERATOR:
+        VM_CASE (VM_OC_GET_ITERATOR):
         {
           result = ecma_op_get_iterator (stack_top_p[-1], ECMA_VALUE_EMPTY);
 
@@ -2010,7 +2418,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_ITERATOR_STEP:
+        VM_CASE (VM_OC_ITERATOR_STEP):
         {
           JERRY_ASSERT (opcode >= CBC_EXT_ITERATOR_STEP && opcode <= CBC_EXT_ITERATOR_STEP_3);
           const uint8_t index = (uint8_t) (1 + (opcode - CBC_EXT_ITERATOR_STEP));
@@ -2038,7 +2446,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = value;
           continue;
         }
-        case VM_OC_ITERATOR_CLOSE:
+        VM_CASE (VM_OC_ITERATOR_CLOSE):
         {
           result = ecma_op_iterator_close (left_value);
 
@@ -2049,7 +2457,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_DEFAULT_INITIALIZER:
+        VM_CASE (VM_OC_DEFAULT_INITIALIZER):
         {
           JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
 
@@ -2062,7 +2470,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p--;
           continue;
         }
-        case VM_OC_REST_INITIALIZER:
+        VM_CASE (VM_OC_REST_INITIALIZER):
         {
           JERRY_ASSERT (opcode >= CBC_EXT_REST_INITIALIZER && opcode <= CBC_EXT_REST_INITIALIZER_3);
           const uint8_t iterator_index = (uint8_t) (1 + (opcode - CBC_EXT_REST_INITIALIZER));
@@ -2103,9 +2511,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_object_value (array_p);
           continue;
         }
-        case VM_OC_INITIALIZER_PUSH_PROP:
+        VM_CASE (VM_OC_INITIALIZER_PUSH_PROP):
         {
-          result = vm_op_get_value (stack_top_p[-1], left_value);
+          result = vm_op_get_value (stack_top_p[-1], left_value, byte_code_start_p);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2115,7 +2523,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_SPREAD_ARGUMENTS:
+        VM_CASE (VM_OC_SPREAD_ARGUMENTS):
         {
           uint8_t arguments_list_len = *byte_code_p++;
           stack_top_p -= arguments_list_len;
@@ -2136,7 +2544,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_CREATE_GENERATOR:
+        VM_CASE (VM_OC_CREATE_GENERATOR):
         {
           frame_ctx_p->call_operation = VM_EXEC_RETURN;
           frame_ctx_p->byte_code_p = byte_code_p;
@@ -2150,18 +2558,18 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           return result;
         }
-        case VM_OC_YIELD:
+        VM_CASE (VM_OC_YIELD):
         {
           frame_ctx_p->call_operation = VM_EXEC_RETURN;
           frame_ctx_p->byte_code_p = byte_code_p;
           frame_ctx_p->stack_top_p = --stack_top_p;
           return *stack_top_p;
         }
-        case VM_OC_AWAIT:
+        VM_CASE (VM_OC_AWAIT):
         {
           continue;
         }
-        case VM_OC_EXT_RETURN:
+        VM_CASE (VM_OC_EXT_RETURN):
         {
           result = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
@@ -2175,13 +2583,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto error;
         }
-        case VM_OC_RETURN_PROMISE:
+        VM_CASE (VM_OC_RETURN_PROMISE):
         {
           result = opfunc_return_promise (left_value);
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_STRING_CONCAT:
+        VM_CASE (VM_OC_STRING_CONCAT):
         {
           ecma_string_t *left_str_p = ecma_op_to_string (left_value);
 
@@ -2205,7 +2613,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_string_value (result_str_p);
           goto free_both_values;
         }
-        case VM_OC_GET_TEMPLATE_OBJECT:
+        VM_CASE (VM_OC_GET_TEMPLATE_OBJECT):
         {
           uint8_t tagged_idx = *byte_code_p++;
           ecma_collection_t *collection_p = ecma_compiled_code_get_tagged_template_collection (bytecode_header_p);
@@ -2214,7 +2622,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_copy_value (collection_p->buffer_p[tagged_idx]);
           continue;
         }
-        case VM_OC_PUSH_NEW_TARGET:
+        VM_CASE (VM_OC_PUSH_NEW_TARGET):
         {
           ecma_object_t *new_target_object = JERRY_CONTEXT (current_new_target);
           if (new_target_object == NULL)
@@ -2228,7 +2636,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_REQUIRE_OBJECT_COERCIBLE:
+        VM_CASE (VM_OC_REQUIRE_OBJECT_COERCIBLE):
         {
           result = ecma_op_check_object_coercible (stack_top_p[-1]);
 
@@ -2238,7 +2646,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_ASSIGN_SUPER:
+        VM_CASE (VM_OC_ASSIGN_SUPER):
         {
           result = opfunc_assign_super_reference (&stack_top_p, frame_ctx_p, opcode_data);
 
@@ -2249,12 +2657,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #endif /* ENABLED (JERRY_ES2015) */
-        case VM_OC_PUSH_ELISON:
+        VM_CASE (VM_OC_PUSH_ELISON):
         {
           *stack_top_p++ = ECMA_VALUE_ARRAY_HOLE;
           continue;
         }
-        case VM_OC_APPEND_ARRAY:
+        VM_CASE (VM_OC_APPEND_ARRAY):
         {
           uint16_t values_length = *byte_code_p++;
           stack_top_p -= values_length;
@@ -2277,7 +2685,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 #endif /* ENABLED (JERRY_ES2015) */
           continue;
         }
-        case VM_OC_IDENT_REFERENCE:
+        VM_CASE (VM_OC_IDENT_REFERENCE):
         {
           uint16_t literal_index;
 
@@ -2314,9 +2722,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_PROP_GET:
+        VM_CASE (VM_OC_PROP_GET):
         {
-          result = vm_op_get_value (left_value, right_value);
+          result = vm_op_get_value (left_value, right_value, byte_code_start_p);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2326,7 +2734,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_PROP_REFERENCE:
+        VM_CASE (VM_OC_PROP_REFERENCE):
         {
           /* Forms with reference requires preserving the base and offset. */
 
@@ -2350,13 +2758,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_PROP_PRE_INCR:
-        case VM_OC_PROP_PRE_DECR:
-        case VM_OC_PROP_POST_INCR:
-        case VM_OC_PROP_POST_DECR:
+        VM_CASE (VM_OC_PROP_PRE_INCR):
+        VM_CASE (VM_OC_PROP_PRE_DECR):
+        VM_CASE (VM_OC_PROP_POST_INCR):
+        VM_CASE (VM_OC_PROP_POST_DECR):
         {
           result = vm_op_get_value (left_value,
-                                    right_value);
+                                    right_value,
+                                    byte_code_start_p);
 
           if (opcode < CBC_PRE_INCR)
           {
@@ -2379,10 +2788,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           right_value = ECMA_VALUE_UNDEFINED;
           /* FALLTHRU */
         }
-        case VM_OC_PRE_INCR:
-        case VM_OC_PRE_DECR:
-        case VM_OC_POST_INCR:
-        case VM_OC_POST_DECR:
+        VM_CASE (VM_OC_PRE_INCR):
+        VM_CASE (VM_OC_PRE_DECR):
+        VM_CASE (VM_OC_POST_INCR):
+        VM_CASE (VM_OC_POST_DECR):
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
 
@@ -2518,7 +2927,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_ASSIGN:
+        VM_CASE (VM_OC_ASSIGN):
         {
 #if defined(JERRY_FUNCTION_NAME) && !defined(__APPLE__)
           if (ecma_is_value_object(left_value) && ecma_op_is_callable(left_value)) {
@@ -2541,7 +2950,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_MOV_IDENT:
+        VM_CASE (VM_OC_MOV_IDENT):
         {
           uint32_t literal_index;
 
@@ -2554,7 +2963,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           VM_GET_REGISTER (frame_ctx_p, literal_index) = left_value;
           continue;
         }
-        case VM_OC_ASSIGN_PROP:
+        VM_CASE (VM_OC_ASSIGN_PROP):
         {
 #if defined(JERRY_FUNCTION_NAME) && !defined(__APPLE__)
           if (ecma_is_value_object(left_value) && ecma_op_is_callable(left_value)) {
@@ -2578,7 +2987,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_ASSIGN_PROP_THIS:
+        VM_CASE (VM_OC_ASSIGN_PROP_THIS):
         {
 #if defined(JERRY_FUNCTION_NAME) && !defined(__APPLE__)
           if (ecma_is_value_object(left_value) && ecma_op_is_callable(left_value)) {
@@ -2603,7 +3012,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_RETURN:
+        VM_CASE (VM_OC_RETURN):
         {
           JERRY_ASSERT (opcode == CBC_RETURN
                         || opcode == CBC_RETURN_WITH_BLOCK
@@ -2619,7 +3028,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_THROW:
+        VM_CASE (VM_OC_THROW):
         {
           jcontext_raise_exception (left_value);
 
@@ -2627,12 +3036,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_THROW_REFERENCE_ERROR:
+        VM_CASE (VM_OC_THROW_REFERENCE_ERROR):
         {
           result = ecma_raise_reference_error (ECMA_ERR_MSG ("Undefined reference."));
           goto error;
         }
-        case VM_OC_EVAL:
+        VM_CASE (VM_OC_EVAL):
         {
           JERRY_CONTEXT (status_flags) |= ECMA_STATUS_DIRECT_EVAL;
           JERRY_ASSERT ((*byte_code_p >= CBC_CALL && *byte_code_p <= CBC_CALL2_PROP_BLOCK)
@@ -2641,21 +3050,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                             && byte_code_p[1] <= CBC_EXT_SPREAD_CALL_PROP_BLOCK));
           continue;
         }
-        case VM_OC_CALL:
+        VM_CASE (VM_OC_CALL):
         {
           frame_ctx_p->call_operation = VM_EXEC_CALL;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_NEW:
+        VM_CASE (VM_OC_NEW):
         {
           frame_ctx_p->call_operation = VM_EXEC_CONSTRUCT;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_ERROR:
+        VM_CASE (VM_OC_ERROR):
         {
           JERRY_ASSERT (frame_ctx_p->byte_code_p[1] == CBC_EXT_ERROR);
 #if ENABLED (JERRY_DEBUGGER)
@@ -2665,7 +3074,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = ECMA_VALUE_ERROR;
           goto error;
         }
-        case VM_OC_RESOLVE_BASE_FOR_CALL:
+        VM_CASE (VM_OC_RESOLVE_BASE_FOR_CALL):
         {
           ecma_value_t this_value = stack_top_p[-3];
 
@@ -2683,7 +3092,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_PROP_DELETE:
+        VM_CASE (VM_OC_PROP_DELETE):
         {
           result = vm_op_delete_prop (left_value, right_value, is_strict);
 
@@ -2697,7 +3106,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_DELETE:
+        VM_CASE (VM_OC_DELETE):
         {
           uint16_t literal_index;
 
@@ -2722,12 +3131,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_JUMP:
+        VM_CASE (VM_OC_JUMP):
         {
           byte_code_p = byte_code_start_p + branch_offset;
           continue;
         }
-        case VM_OC_BRANCH_IF_STRICT_EQUAL:
+        VM_CASE (VM_OC_BRANCH_IF_STRICT_EQUAL):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -2741,10 +3150,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_free_value (value);
           continue;
         }
-        case VM_OC_BRANCH_IF_TRUE:
-        case VM_OC_BRANCH_IF_FALSE:
-        case VM_OC_BRANCH_IF_LOGICAL_TRUE:
-        case VM_OC_BRANCH_IF_LOGICAL_FALSE:
+        VM_CASE (VM_OC_BRANCH_IF_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_FALSE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_FALSE):
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_BRANCH_IF_TRUE;
           ecma_value_t value = *(--stack_top_p);
@@ -2770,8 +3179,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_fast_free_value (value);
           continue;
         }
-        case VM_OC_PLUS:
-        case VM_OC_MINUS:
+        VM_CASE (VM_OC_PLUS):
+        VM_CASE (VM_OC_MINUS):
         {
           result = opfunc_unary_operation (left_value, VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_PLUS);
 
@@ -2783,13 +3192,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_NOT:
+        VM_CASE (VM_OC_NOT):
         {
           *stack_top_p++ = ecma_make_boolean_value (!ecma_op_to_boolean (left_value));
           JERRY_ASSERT (ecma_is_value_boolean (stack_top_p[-1]));
           goto free_left_value;
         }
-        case VM_OC_BIT_NOT:
+        VM_CASE (VM_OC_BIT_NOT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -2812,12 +3221,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_VOID:
+        VM_CASE (VM_OC_VOID):
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
           goto free_left_value;
         }
-        case VM_OC_TYPEOF_IDENT:
+        VM_CASE (VM_OC_TYPEOF_IDENT):
         {
           uint16_t literal_index;
 
@@ -2853,7 +3262,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_TYPEOF:
+        VM_CASE (VM_OC_TYPEOF):
         {
           result = opfunc_typeof (left_value);
 
@@ -2865,13 +3274,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_ADD:
+        VM_CASE (VM_OC_ADD):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
-            *stack_top_p++ = ecma_make_int32_value ((int32_t) (left_integer + right_integer));
+            VM_PUSH_BINARY_VALUE (ecma_make_int32_value ((int32_t) (left_integer + right_integer)));
             continue;
           }
 
@@ -2881,8 +3290,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t new_value = (ecma_get_float_from_value (left_value) +
                                        ecma_get_number_from_value (right_value));
 
-            *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
+            VM_PUSH_BINARY_VALUE (ecma_update_float_number (left_value, new_value));
             continue;
           }
 
@@ -2892,7 +3301,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t new_value = ((ecma_number_t) ecma_get_integer_from_value (left_value) +
                                        ecma_get_float_from_value (right_value));
 
-            *stack_top_p++ = ecma_update_float_number (right_value, new_value);
+            VM_PUSH_BINARY_VALUE (ecma_update_float_number (right_value, new_value));
             continue;
           }
 
@@ -2903,10 +3312,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_SUB:
+        VM_CASE (VM_OC_SUB):
         {
           JERRY_STATIC_ASSERT (ECMA_INTEGER_NUMBER_MAX * 2 <= INT32_MAX
                                && ECMA_INTEGER_NUMBER_MIN * 2 >= INT32_MIN,
@@ -2919,7 +3327,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
-            *stack_top_p++ = ecma_make_int32_value ((int32_t) (left_integer - right_integer));
+            VM_PUSH_BINARY_VALUE (ecma_make_int32_value ((int32_t) (left_integer - right_integer)));
             continue;
           }
 
@@ -2929,8 +3337,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t new_value = (ecma_get_float_from_value (left_value) -
                                        ecma_get_number_from_value (right_value));
 
-            *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
+            VM_PUSH_BINARY_VALUE (ecma_update_float_number (left_value, new_value));
             continue;
           }
 
@@ -2940,7 +3348,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t new_value = ((ecma_number_t) ecma_get_integer_from_value (left_value) -
                                        ecma_get_float_from_value (right_value));
 
-            *stack_top_p++ = ecma_update_float_number (right_value, new_value);
+            VM_PUSH_BINARY_VALUE (ecma_update_float_number (right_value, new_value));
             continue;
           }
 
@@ -2953,36 +3361,19 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_MUL:
+        VM_CASE (VM_OC_MUL):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
 
-          JERRY_STATIC_ASSERT (ECMA_INTEGER_MULTIPLY_MAX * ECMA_INTEGER_MULTIPLY_MAX <= ECMA_INTEGER_NUMBER_MAX
-                               && -(ECMA_INTEGER_MULTIPLY_MAX * ECMA_INTEGER_MULTIPLY_MAX) >= ECMA_INTEGER_NUMBER_MIN,
-                               square_of_integer_multiply_max_must_fit_into_integer_value_range);
-
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
 
-            if (-ECMA_INTEGER_MULTIPLY_MAX <= left_integer
-                && left_integer <= ECMA_INTEGER_MULTIPLY_MAX
-                && -ECMA_INTEGER_MULTIPLY_MAX <= right_integer
-                && right_integer <= ECMA_INTEGER_MULTIPLY_MAX
-                && left_value != 0
-                && right_value != 0)
-            {
-              *stack_top_p++ = ecma_integer_multiply (left_integer, right_integer);
-              continue;
-            }
-
-            ecma_number_t multiply = (ecma_number_t) left_integer * (ecma_number_t) right_integer;
-            *stack_top_p++ = ecma_make_number_value (multiply);
+            VM_PUSH_BINARY_VALUE (ecma_integer_multiply (left_integer, right_integer));
             continue;
           }
 
@@ -2992,8 +3383,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t new_value = (ecma_get_float_from_value (left_value) *
                                        ecma_get_number_from_value (right_value));
 
-            *stack_top_p++ = ecma_update_float_number (left_value, new_value);
             ecma_free_number (right_value);
+            VM_PUSH_BINARY_VALUE (ecma_update_float_number (left_value, new_value));
             continue;
           }
 
@@ -3003,7 +3394,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t new_value = ((ecma_number_t) ecma_get_integer_from_value (left_value) *
                                        ecma_get_float_from_value (right_value));
 
-            *stack_top_p++ = ecma_update_float_number (right_value, new_value);
+            VM_PUSH_BINARY_VALUE (ecma_update_float_number (right_value, new_value));
             continue;
           }
 
@@ -3016,14 +3407,53 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_DIV:
+        VM_CASE (VM_OC_DIV):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
 
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+            ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+
+            /* Exact divisions are integers, except zero divided by a negative number. */
+            if (right_integer != 0
+                && left_integer % right_integer == 0
+                && (left_integer != 0 || right_integer > 0))
+            {
+              VM_PUSH_BINARY_VALUE (ecma_make_int32_value (left_integer / right_integer));
+              continue;
+            }
+
+            ecma_number_t quotient = (ecma_number_t) left_integer / (ecma_number_t) right_integer;
+            VM_PUSH_BINARY_VALUE (ecma_make_number_value (quotient));
+            continue;
+          }
+
+          if (ecma_is_value_float_number (left_value)
+              && ecma_is_value_number (right_value))
+          {
+            ecma_number_t new_value = (ecma_get_float_from_value (left_value) /
+                                       ecma_get_number_from_value (right_value));
+
+            ecma_free_number (right_value);
+            VM_PUSH_BINARY_VALUE (ecma_update_float_number (left_value, new_value));
+            continue;
+          }
+
+          if (ecma_is_value_float_number (right_value)
+              && ecma_is_value_integer_number (left_value))
+          {
+            ecma_number_t new_value = ((ecma_number_t) ecma_get_integer_from_value (left_value) /
+                                       ecma_get_float_from_value (right_value));
+
+            VM_PUSH_BINARY_VALUE (ecma_update_float_number (right_value, new_value));
+            continue;
+          }
+
           result = do_number_arithmetic (NUMBER_ARITHMETIC_DIVISION,
                                          left_value,
                                          right_value);
@@ -3033,10 +3463,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_MOD:
+        VM_CASE (VM_OC_MOD):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
@@ -3052,7 +3481,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
               if (mod_result != 0 || left_integer >= 0)
               {
-                *stack_top_p++ = ecma_make_integer_value (mod_result);
+                VM_PUSH_BINARY_VALUE (ecma_make_integer_value (mod_result));
                 continue;
               }
             }
@@ -3067,11 +3496,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
 #if ENABLED (JERRY_ES2015)
-        case VM_OC_EXP:
+        VM_CASE (VM_OC_EXP):
         {
           result = do_number_arithmetic (NUMBER_ARITHMETIC_EXPONENTIATION,
                                          left_value,
@@ -3086,7 +3514,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           goto free_both_values;
         }
 #endif /* ENABLED (JERRY_ES2015) */
-        case VM_OC_EQUAL:
+        VM_CASE (VM_OC_EQUAL):
         {
           result = opfunc_equality (left_value, right_value);
 
@@ -3095,10 +3523,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_NOT_EQUAL:
+        VM_CASE (VM_OC_NOT_EQUAL):
         {
           result = opfunc_equality (left_value, right_value);
 
@@ -3107,35 +3534,33 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = ecma_invert_boolean_value (result);
-          goto free_both_values;
+          result = ecma_invert_boolean_value (result);
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_STRICT_EQUAL:
+        VM_CASE (VM_OC_STRICT_EQUAL):
         {
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
           result = ecma_make_boolean_value (is_equal);
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_STRICT_NOT_EQUAL:
+        VM_CASE (VM_OC_STRICT_NOT_EQUAL):
         {
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
           result = ecma_make_boolean_value (!is_equal);
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_BIT_OR:
+        VM_CASE (VM_OC_BIT_OR):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
 
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
-            *stack_top_p++ = left_value | right_value;
+            VM_PUSH_BINARY_VALUE (left_value | right_value);
             continue;
           }
 
@@ -3148,17 +3573,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_BIT_XOR:
+        VM_CASE (VM_OC_BIT_XOR):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
 
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
-            *stack_top_p++ = (left_value ^ right_value) & (ecma_value_t) (~ECMA_DIRECT_TYPE_MASK);
+            VM_PUSH_BINARY_VALUE ((left_value ^ right_value) & (ecma_value_t) (~ECMA_DIRECT_TYPE_MASK));
             continue;
           }
 
@@ -3171,17 +3595,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_BIT_AND:
+        VM_CASE (VM_OC_BIT_AND):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
 
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
-            *stack_top_p++ = left_value & right_value;
+            VM_PUSH_BINARY_VALUE (left_value & right_value);
             continue;
           }
 
@@ -3194,10 +3617,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_LEFT_SHIFT:
+        VM_CASE (VM_OC_LEFT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3206,7 +3628,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
-            *stack_top_p++ = ecma_make_int32_value ((int32_t) (left_integer << (right_integer & 0x1f)));
+            VM_PUSH_BINARY_VALUE (ecma_make_int32_value ((int32_t) (left_integer << (right_integer & 0x1f))));
             continue;
           }
 
@@ -3219,10 +3641,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_RIGHT_SHIFT:
+        VM_CASE (VM_OC_RIGHT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3231,7 +3652,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
-            *stack_top_p++ = ecma_make_integer_value (left_integer >> (right_integer & 0x1f));
+            VM_PUSH_BINARY_VALUE (ecma_make_integer_value (left_integer >> (right_integer & 0x1f)));
             continue;
           }
 
@@ -3244,10 +3665,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_UNS_RIGHT_SHIFT:
+        VM_CASE (VM_OC_UNS_RIGHT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3256,7 +3676,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             uint32_t left_uint32 = (uint32_t) ecma_get_integer_from_value (left_value);
             ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
-            *stack_top_p++ = ecma_make_uint32_value (left_uint32 >> (right_integer & 0x1f));
+            VM_PUSH_BINARY_VALUE (ecma_make_uint32_value (left_uint32 >> (right_integer & 0x1f)));
             continue;
           }
 
@@ -3269,18 +3689,19 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_LESS:
+        VM_CASE (VM_OC_LESS):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             bool is_less = (ecma_integer_value_t) left_value < (ecma_integer_value_t) right_value;
-#if !ENABLED (JERRY_VM_EXEC_STOP)
+#if !ENABLED (JERRY_VM_EXEC_STOP) && !ENABLED (JERRY_VM_PROFILER)
             /* This is a lookahead to the next opcode to improve performance.
-             * If it is CBC_BRANCH_IF_TRUE_BACKWARD, execute it. */
-            if (*byte_code_p <= CBC_BRANCH_IF_TRUE_BACKWARD_3 && *byte_code_p >= CBC_BRANCH_IF_TRUE_BACKWARD)
+             * If it is CBC_BRANCH_IF_TRUE_BACKWARD, execute it. The three-address
+             * form is followed by its identifier argument instead. */
+            if (!VM_HAS_BINARY_IDENT_RESULT (opcode_data)
+                && *byte_code_p <= CBC_BRANCH_IF_TRUE_BACKWARD_3 && *byte_code_p >= CBC_BRANCH_IF_TRUE_BACKWARD)
             {
               byte_code_start_p = byte_code_p++;
               branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (*byte_code_start_p);
@@ -3311,8 +3732,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
               continue;
             }
-#endif /* !ENABLED (JERRY_VM_EXEC_STOP) */
-            *stack_top_p++ = ecma_make_boolean_value (is_less);
+#endif /* !ENABLED (JERRY_VM_EXEC_STOP) && !ENABLED (JERRY_VM_PROFILER) */
+            VM_PUSH_BINARY_VALUE (ecma_make_boolean_value (is_less));
             continue;
           }
 
@@ -3321,8 +3742,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t left_number = ecma_get_number_from_value (left_value);
             ecma_number_t right_number = ecma_get_number_from_value (right_value);
 
-            *stack_top_p++ = ecma_make_boolean_value (left_number < right_number);
-            goto free_both_values;
+            result = ecma_make_boolean_value (left_number < right_number);
+            VM_PUSH_BINARY_RESULT ();
           }
 
           result = opfunc_relation (left_value, right_value, true, false);
@@ -3332,17 +3753,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_GREATER:
+        VM_CASE (VM_OC_GREATER):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
             ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
 
-            *stack_top_p++ = ecma_make_boolean_value (left_integer > right_integer);
+            VM_PUSH_BINARY_VALUE (ecma_make_boolean_value (left_integer > right_integer));
             continue;
           }
 
@@ -3351,8 +3771,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t left_number = ecma_get_number_from_value (left_value);
             ecma_number_t right_number = ecma_get_number_from_value (right_value);
 
-            *stack_top_p++ = ecma_make_boolean_value (left_number > right_number);
-            goto free_both_values;
+            result = ecma_make_boolean_value (left_number > right_number);
+            VM_PUSH_BINARY_RESULT ();
           }
 
           result = opfunc_relation (left_value, right_value, false, false);
@@ -3362,17 +3782,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_LESS_EQUAL:
+        VM_CASE (VM_OC_LESS_EQUAL):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
             ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
 
-            *stack_top_p++ = ecma_make_boolean_value (left_integer <= right_integer);
+            VM_PUSH_BINARY_VALUE (ecma_make_boolean_value (left_integer <= right_integer));
             continue;
           }
 
@@ -3381,8 +3800,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t left_number = ecma_get_number_from_value (left_value);
             ecma_number_t right_number = ecma_get_number_from_value (right_value);
 
-            *stack_top_p++ = ecma_make_boolean_value (left_number <= right_number);
-            goto free_both_values;
+            result = ecma_make_boolean_value (left_number <= right_number);
+            VM_PUSH_BINARY_RESULT ();
           }
 
           result = opfunc_relation (left_value, right_value, false, true);
@@ -3392,17 +3811,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_GREATER_EQUAL:
+        VM_CASE (VM_OC_GREATER_EQUAL):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
             ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
             ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
 
-            *stack_top_p++ = ecma_make_boolean_value (left_integer >= right_integer);
+            VM_PUSH_BINARY_VALUE (ecma_make_boolean_value (left_integer >= right_integer));
             continue;
           }
 
@@ -3411,8 +3829,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_number_t left_number = ecma_get_number_from_value (left_value);
             ecma_number_t right_number = ecma_get_number_from_value (right_value);
 
-            *stack_top_p++ = ecma_make_boolean_value (left_number >= right_number);
-            goto free_both_values;
+            result = ecma_make_boolean_value (left_number >= right_number);
+            VM_PUSH_BINARY_RESULT ();
           }
 
           result = opfunc_relation (left_value, right_value, true, true);
@@ -3422,10 +3840,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_IN:
+        VM_CASE (VM_OC_IN):
         {
           result = opfunc_in (left_value, right_value);
 
@@ -3434,10 +3851,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_INSTANCEOF:
+        VM_CASE (VM_OC_INSTANCEOF):
         {
           result = opfunc_instanceof (left_value, right_value);
 
@@ -3446,10 +3862,136 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             goto error;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          VM_PUSH_BINARY_RESULT ();
         }
-        case VM_OC_BLOCK_CREATE_CONTEXT:
+#if ENABLED (JERRY_VM_SUPERINSTRUCTIONS)
+        VM_CASE (VM_OC_STRICT_EQUAL_AND_BRANCH):
+        VM_CASE (VM_OC_STRICT_NOT_EQUAL_AND_BRANCH):
+        VM_CASE (VM_OC_LESS_AND_BRANCH):
+        VM_CASE (VM_OC_GREATER_AND_BRANCH):
+        VM_CASE (VM_OC_LESS_EQUAL_AND_BRANCH):
+        VM_CASE (VM_OC_GREATER_EQUAL_AND_BRANCH):
+        {
+          uint32_t group = VM_OC_GROUP_GET_INDEX (opcode_data);
+          bool is_true;
+
+          if (group < VM_OC_LESS_AND_BRANCH)
+          {
+            is_true = ecma_op_strict_equality_compare (left_value, right_value);
+
+            if (group == VM_OC_STRICT_NOT_EQUAL_AND_BRANCH)
+            {
+              is_true = !is_true;
+            }
+          }
+          else
+          {
+            uint32_t opcode_flags = group - VM_OC_LESS_AND_BRANCH;
+
+            if (ecma_are_values_integer_numbers (left_value, right_value))
+            {
+              ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
+              ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
+
+              if (opcode_flags & VM_OC_COMPARE_AND_BRANCH_SWAP_FLAG)
+              {
+                left_integer = (ecma_integer_value_t) right_value;
+                right_integer = (ecma_integer_value_t) left_value;
+              }
+
+              is_true = ((opcode_flags & VM_OC_COMPARE_AND_BRANCH_OR_EQUAL_FLAG) ? left_integer <= right_integer
+                                                                                  : left_integer < right_integer);
+            }
+            else if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+            {
+              ecma_number_t left_number = ecma_get_number_from_value (left_value);
+              ecma_number_t right_number = ecma_get_number_from_value (right_value);
+
+              if (opcode_flags & VM_OC_COMPARE_AND_BRANCH_SWAP_FLAG)
+              {
+                left_number = ecma_get_number_from_value (right_value);
+                right_number = ecma_get_number_from_value (left_value);
+              }
+
+              is_true = ((opcode_flags & VM_OC_COMPARE_AND_BRANCH_OR_EQUAL_FLAG) ? left_number <= right_number
+                                                                                  : left_number < right_number);
+            }
+            else
+            {
+              /* Same arguments as the arguments used by the non-fused comparisons. */
+              bool is_swapped = (opcode_flags & VM_OC_COMPARE_AND_BRANCH_SWAP_FLAG) != 0;
+              bool is_or_equal = (opcode_flags & VM_OC_COMPARE_AND_BRANCH_OR_EQUAL_FLAG) != 0;
+
+              result = opfunc_relation (left_value, right_value, is_swapped == is_or_equal, is_or_equal);
+
+              if (ECMA_IS_VALUE_ERROR (result))
+              {
+                goto error;
+              }
+
+              is_true = ecma_is_value_true (result);
+            }
+          }
+
+          ecma_fast_free_value (left_value);
+          ecma_fast_free_value (right_value);
+
+          /* The superinstruction is always followed by a conditional branch. */
+          JERRY_ASSERT (VM_OC_GROUP_GET_INDEX (vm_decode_table[*byte_code_p]) == VM_OC_BRANCH_IF_TRUE
+                        || VM_OC_GROUP_GET_INDEX (vm_decode_table[*byte_code_p]) == VM_OC_BRANCH_IF_FALSE);
+
+          byte_code_start_p = byte_code_p++;
+          opcode_data = vm_decode_table[*byte_code_start_p];
+
+#if ENABLED (JERRY_VM_EXEC_STOP) || ENABLED (JERRY_VM_PROFILER)
+          if (opcode_data & VM_OC_BACKWARD_BRANCH)
+          {
+            /* The branch is executed separately, since it may call the exec stop
+             * callback or take a profiler sample. */
+            byte_code_p = byte_code_start_p;
+            *stack_top_p++ = ecma_make_boolean_value (is_true);
+            continue;
+          }
+#endif /* ENABLED (JERRY_VM_EXEC_STOP) || ENABLED (JERRY_VM_PROFILER) */
+
+          if (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_BRANCH_IF_FALSE)
+          {
+            is_true = !is_true;
+          }
+
+          branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (*byte_code_start_p);
+          JERRY_ASSERT (branch_offset_length >= 1 && branch_offset_length <= 3);
+
+          if (!is_true)
+          {
+            byte_code_p += branch_offset_length;
+            continue;
+          }
+
+          branch_offset = *(byte_code_p++);
+
+          if (JERRY_UNLIKELY (branch_offset_length != 1))
+          {
+            branch_offset <<= 8;
+            branch_offset |= *(byte_code_p++);
+
+            if (JERRY_UNLIKELY (branch_offset_length == 3))
+            {
+              branch_offset <<= 8;
+              branch_offset |= *(byte_code_p++);
+            }
+          }
+
+          if (opcode_data & VM_OC_BACKWARD_BRANCH)
+          {
+            branch_offset = -branch_offset;
+          }
+
+          byte_code_p = byte_code_start_p + branch_offset;
+          continue;
+        }
+#endif /* ENABLED (JERRY_VM_SUPERINSTRUCTIONS) */
+        VM_CASE (VM_OC_BLOCK_CREATE_CONTEXT):
         {
 #if ENABLED (JERRY_ES2015)
           ecma_value_t *stack_context_top_p;
@@ -3498,7 +4040,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_WITH:
+        VM_CASE (VM_OC_WITH):
         {
           ecma_value_t value = *(--stack_top_p);
           ecma_object_t *object_p;
@@ -3532,7 +4074,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->lex_env_p = with_env_p;
           continue;
         }
-        case VM_OC_FOR_IN_CREATE_CONTEXT:
+        VM_CASE (VM_OC_FOR_IN_CREATE_CONTEXT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -3582,7 +4124,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 #endif /* ENABLED (JERRY_ES2015) */
           continue;
         }
-        case VM_OC_FOR_IN_GET_NEXT:
+        VM_CASE (VM_OC_FOR_IN_GET_NEXT):
         {
           ecma_value_t *context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
 
@@ -3598,7 +4140,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           context_top_p[-3]++;
           continue;
         }
-        case VM_OC_FOR_IN_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_IN_HAS_NEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -3644,7 +4186,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if ENABLED (JERRY_ES2015)
-        case VM_OC_FOR_OF_CREATE_CONTEXT:
+        VM_CASE (VM_OC_FOR_OF_CREATE_CONTEXT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -3691,7 +4233,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_FOR_OF_GET_NEXT:
+        VM_CASE (VM_OC_FOR_OF_GET_NEXT):
         {
           ecma_value_t *context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (context_top_p[-1]) == VM_CONTEXT_FOR_OF);
@@ -3707,7 +4249,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = next_value;
           continue;
         }
-        case VM_OC_FOR_OF_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_OF_HAS_NEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -3734,7 +4276,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #endif /* ENABLED (JERRY_ES2015) */
-        case VM_OC_TRY:
+        VM_CASE (VM_OC_TRY):
         {
           /* Try opcode simply creates the try context. */
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
@@ -3747,7 +4289,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-1] = VM_CREATE_CONTEXT (VM_CONTEXT_TRY, branch_offset);
           continue;
         }
-        case VM_OC_CATCH:
+        VM_CASE (VM_OC_CATCH):
         {
           /* Catches are ignored and turned to jumps. */
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
@@ -3756,7 +4298,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           byte_code_p = byte_code_start_p + branch_offset;
           continue;
         }
-        case VM_OC_FINALLY:
+        VM_CASE (VM_OC_FINALLY):
         {
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
 
@@ -3779,7 +4321,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-2] = (ecma_value_t) branch_offset;
           continue;
         }
-        case VM_OC_CONTEXT_END:
+        VM_CASE (VM_OC_CONTEXT_END):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (!(stack_top_p[-1] & VM_CONTEXT_CLOSE_ITERATOR));
@@ -3846,7 +4388,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           continue;
         }
-        case VM_OC_JUMP_AND_EXIT_CONTEXT:
+        VM_CASE (VM_OC_JUMP_AND_EXIT_CONTEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (!jcontext_has_pending_exception ());
@@ -3879,7 +4421,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if ENABLED (JERRY_DEBUGGER)
-        case VM_OC_BREAKPOINT_ENABLED:
+        VM_CASE (VM_OC_BREAKPOINT_ENABLED):
         {
           if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_VM_IGNORE)
           {
@@ -3900,7 +4442,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_BREAKPOINT_DISABLED:
+        VM_CASE (VM_OC_BREAKPOINT_DISABLED):
         {
           if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_VM_IGNORE)
           {
@@ -3954,14 +4496,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
 #endif /* ENABLED (JERRY_DEBUGGER) */
 #if ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ES2015_MODULE_SYSTEM)
-        case VM_OC_RESOURCE_NAME:
+        VM_CASE (VM_OC_RESOURCE_NAME):
         {
           frame_ctx_p->resource_name = ecma_op_resource_name (bytecode_header_p);
           continue;
         }
 #endif /* ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ES2015_MODULE_SYSTEM) */
 #if ENABLED (JERRY_LINE_INFO)
-        case VM_OC_LINE:
+        VM_CASE (VM_OC_LINE):
         {
           uint32_t value = 0;
           uint8_t byte;
@@ -3977,7 +4519,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #endif /* ENABLED (JERRY_LINE_INFO) */
-        case VM_OC_NONE:
+        VM_CASE (VM_OC_NONE):
         default:
         {
           JERRY_ASSERT (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_NONE);
@@ -3986,6 +4528,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
       }
 
+put_result:
       JERRY_ASSERT (VM_OC_HAS_PUT_RESULT (opcode_data));
 
       if (opcode_data & VM_OC_PUT_IDENT)
@@ -4066,7 +4609,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_value_t set_value_result = vm_op_set_value (base,
                                                            property,
                                                            result,
-                                                           is_strict);
+                                                           is_strict,
+                                                           byte_code_start_p);
 
           if (ECMA_IS_VALUE_ERROR (set_value_result))
           {
@@ -4351,8 +4895,197 @@ vm_init_exec (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
 
   JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_DIRECT_EVAL;
   JERRY_CONTEXT (vm_top_context_p) = frame_ctx_p;
+
+#if ENABLED (JERRY_VM_PROFILER)
+  VM_PROFILER_TICK (frame_ctx_p, frame_ctx_p->byte_code_p);
+#endif /* ENABLED (JERRY_VM_PROFILER) */
 } /* vm_init_exec */
 
+/**
+ * Compute the size of the frame of a code block.
+ *
+ * @return frame size in uintptr_t units
+ */
+static inline size_t JERRY_ATTR_ALWAYS_INLINE
+vm_get_frame_size (const ecma_compiled_code_t *bytecode_header_p) /**< byte-code data header */
+{
+  size_t frame_size;
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
+    frame_size = (size_t) (args_p->register_end + args_p->stack_limit);
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
+    frame_size = (size_t) (args_p->register_end + args_p->stack_limit);
+  }
+
+  frame_size = frame_size * sizeof (ecma_value_t) + sizeof (vm_frame_ctx_t);
+  return (frame_size + sizeof (uintptr_t) - 1) / sizeof (uintptr_t);
+} /* vm_get_frame_size */
+
+#if ENABLED (JERRY_VM_DIRECT_CALLS)
+
+/**
+ * Size of vm_direct_call_t in uintptr_t units.
+ */
+#define VM_DIRECT_CALL_WORD_COUNT ((sizeof (vm_direct_call_t) + sizeof (uintptr_t) - 1) / sizeof (uintptr_t))
+
+/**
+ * Start the function call opcode of a frame without recursion when the callee
+ * is a plain byte code function.
+ *
+ * Performs the same steps as ecma_op_function_call, except that the frame of the
+ * callee is pushed onto the VM stack and it is executed by the loop of the caller.
+ *
+ * @return frame context of the callee - if the call is started
+ *         NULL - if the call must be performed by opfunc_call
+ */
+static vm_frame_ctx_t *
+vm_direct_call_enter (vm_frame_ctx_t *frame_ctx_p) /**< frame context of the caller */
+{
+  uint32_t arguments_list_len;
+  bool is_call_prop;
+  vm_decode_call (frame_ctx_p, &arguments_list_len, &is_call_prop);
+
+  ecma_value_t *stack_top_p = frame_ctx_p->stack_top_p - arguments_list_len;
+  ecma_value_t func_value = stack_top_p[-1];
+
+  if (!ecma_is_value_object (func_value))
+  {
+    return NULL;
+  }
+
+  ecma_object_t *func_obj_p = ecma_get_object_from_value (func_value);
+
+  if (ecma_get_object_type (func_obj_p) != ECMA_OBJECT_TYPE_FUNCTION
+      || ecma_get_object_is_builtin (func_obj_p))
+  {
+    return NULL;
+  }
+
+  ecma_extended_object_t *ext_func_p = (ecma_extended_object_t *) func_obj_p;
+  const ecma_compiled_code_t *bytecode_data_p = ecma_op_function_get_compiled_code (ext_func_p);
+  uint16_t status_flags = bytecode_data_p->status_flags;
+
+#if ENABLED (JERRY_ES2015)
+  if (status_flags & (CBC_CODE_FLAGS_ARROW_FUNCTION | CBC_CODE_FLAGS_CLASS_CONSTRUCTOR | CBC_CODE_FLAGS_GENERATOR))
+  {
+    return NULL;
+  }
+#endif /* ENABLED (JERRY_ES2015) */
+
+  size_t stack_top = JERRY_CONTEXT (vm_stack_top);
+  size_t frame_size = VM_DIRECT_CALL_WORD_COUNT + vm_get_frame_size (bytecode_data_p);
+
+  if (JERRY_UNLIKELY (frame_size > VM_STACK_WORD_COUNT - stack_top))
+  {
+    /* The recursive path throws the range error. */
+    return NULL;
+  }
+
+  vm_direct_call_t *call_p = (vm_direct_call_t *) (JERRY_CONTEXT (vm_stack) + stack_top);
+  vm_frame_ctx_t *callee_frame_ctx_p = (vm_frame_ctx_t *) (JERRY_CONTEXT (vm_stack)
+                                                           + stack_top + VM_DIRECT_CALL_WORD_COUNT);
+  JERRY_CONTEXT (vm_stack_top) = stack_top + frame_size;
+  call_p->prev_stack_top = stack_top;
+
+#if defined(JERRY_FUNCTION_BACKTRACE) && !defined(__APPLE__)
+  frame_ctx_p->callee_value = func_value;
+#endif
+
+#if ENABLED (JERRY_ES2015)
+  call_p->prev_new_target_p = JERRY_CONTEXT (current_new_target);
+  if (JERRY_UNLIKELY (!(JERRY_CONTEXT (status_flags) & ECMA_STATUS_DIRECT_EVAL)))
+  {
+    JERRY_CONTEXT (current_new_target) = NULL;
+  }
+
+  call_p->prev_function_obj_p = JERRY_CONTEXT (current_function_obj_p);
+  JERRY_CONTEXT (current_function_obj_p) = func_obj_p;
+#endif /* ENABLED (JERRY_ES2015) */
+
+  ecma_value_t this_binding = is_call_prop ? stack_top_p[-3] : ECMA_VALUE_UNDEFINED;
+  call_p->free_this_binding = ECMA_VALUE_UNDEFINED;
+
+  if (!(status_flags & CBC_CODE_FLAGS_STRICT_MODE))
+  {
+    if (ecma_is_value_undefined (this_binding)
+        || ecma_is_value_null (this_binding))
+    {
+      this_binding = ecma_make_object_value (ecma_builtin_get_global ());
+    }
+    else if (!ecma_is_value_object (this_binding))
+    {
+      this_binding = ecma_op_to_object (this_binding);
+      call_p->free_this_binding = this_binding;
+
+      JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (this_binding));
+    }
+  }
+
+  ecma_object_t *local_env_p = ECMA_GET_NON_NULL_POINTER_FROM_POINTER_TAG (ecma_object_t,
+                                                                           ext_func_p->u.function.scope_cp);
+  call_p->local_env_p = NULL;
+
+  if (!(status_flags & CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED))
+  {
+    local_env_p = ecma_create_decl_lex_env (local_env_p);
+    call_p->local_env_p = local_env_p;
+
+    if (status_flags & CBC_CODE_FLAGS_IS_ARGUMENTS_NEEDED)
+    {
+      ecma_op_create_arguments_object (func_obj_p,
+                                       local_env_p,
+                                       stack_top_p,
+                                       arguments_list_len,
+                                       bytecode_data_p);
+    }
+  }
+
+  callee_frame_ctx_p->bytecode_header_p = bytecode_data_p;
+  callee_frame_ctx_p->lex_env_p = local_env_p;
+  callee_frame_ctx_p->this_binding = this_binding;
+
+  vm_init_exec (callee_frame_ctx_p, stack_top_p, arguments_list_len);
+  return callee_frame_ctx_p;
+} /* vm_direct_call_enter */
+
+/**
+ * Finish a call started by vm_direct_call_enter after the frame of the callee returned.
+ *
+ * @return frame context of the caller
+ */
+static vm_frame_ctx_t *
+vm_direct_call_leave (vm_frame_ctx_t *callee_frame_ctx_p, /**< frame context of the callee */
+                      ecma_value_t completion_value) /**< result of the callee */
+{
+  vm_direct_call_t *call_p = ((vm_direct_call_t *) (((uintptr_t *) callee_frame_ctx_p)
+                                                    - VM_DIRECT_CALL_WORD_COUNT));
+  vm_frame_ctx_t *frame_ctx_p = callee_frame_ctx_p->prev_context_p;
+
+#if ENABLED (JERRY_ES2015)
+  JERRY_CONTEXT (current_function_obj_p) = call_p->prev_function_obj_p;
+  JERRY_CONTEXT (current_new_target) = call_p->prev_new_target_p;
+#endif /* ENABLED (JERRY_ES2015) */
+
+  if (call_p->local_env_p != NULL)
+  {
+    ecma_deref_object (call_p->local_env_p);
+  }
+
+  ecma_free_value (call_p->free_this_binding);
+
+  JERRY_CONTEXT (vm_stack_top) = call_p->prev_stack_top;
+
+  vm_complete_call (frame_ctx_p, completion_value);
+  return frame_ctx_p;
+} /* vm_direct_call_leave */
+
+#endif /* ENABLED (JERRY_VM_DIRECT_CALLS) */
+
 /**
  * Resume execution of a code block.
  *
@@ -4361,6 +5094,11 @@ vm_init_exec (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
 ecma_value_t JERRY_ATTR_NOINLINE
 vm_execute (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 {
+#if ENABLED (JERRY_VM_DIRECT_CALLS)
+  /* Number of direct call frames above the frame of this invocation. */
+  uint32_t direct_call_depth = 0;
+#endif /* ENABLED (JERRY_VM_DIRECT_CALLS) */
+
   while (true)
   {
     ecma_value_t completion_value = vm_loop (frame_ctx_p);
@@ -4369,6 +5107,16 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
     {
       case VM_EXEC_CALL:
       {
+#if ENABLED (JERRY_VM_DIRECT_CALLS)
+        vm_frame_ctx_t *callee_frame_ctx_p = vm_direct_call_enter (frame_ctx_p);
+
+        if (callee_frame_ctx_p != NULL)
+        {
+          frame_ctx_p = callee_frame_ctx_p;
+          direct_call_depth++;
+          break;
+        }
+#endif /* ENABLED (JERRY_VM_DIRECT_CALLS) */
         opfunc_call (frame_ctx_p);
         break;
       }
@@ -4385,6 +5133,10 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       }
       case VM_EXEC_RETURN:
       {
+#if ENABLED (JERRY_VM_DIRECT_CALLS)
+        /* Generators are not called directly. */
+        JERRY_ASSERT (direct_call_depth == 0);
+#endif /* ENABLED (JERRY_VM_DIRECT_CALLS) */
         return completion_value;
       }
 #endif /* ENABLED (JERRY_ES2015) */
@@ -4426,6 +5178,16 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 #endif /* ENABLED (JERRY_DEBUGGER) */
 
         JERRY_CONTEXT (vm_top_context_p) = frame_ctx_p->prev_context_p;
+
+#if ENABLED (JERRY_VM_DIRECT_CALLS)
+        if (direct_call_depth > 0)
+        {
+          direct_call_depth--;
+          frame_ctx_p = vm_direct_call_leave (frame_ctx_p, completion_value);
+          break;
+        }
+#endif /* ENABLED (JERRY_VM_DIRECT_CALLS) */
+
         return completion_value;
       }
     }
@@ -4445,26 +5207,36 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
         ecma_length_t arg_list_len) /**< length of arguments list */
 {
   vm_frame_ctx_t *frame_ctx_p;
-  size_t frame_size;
-#if defined(JERRY_FOR_IAR_CONFIG)
+  size_t frame_size = vm_get_frame_size (bytecode_header_p);
+#if defined(JERRY_FOR_IAR_CONFIG) && (JERRY_VM_STACK_SIZE == 0)
   ecma_value_t* stack;
   ecma_value_t ret;
 #endif
 
-  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
-  {
-    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
-    frame_size = (size_t) (args_p->register_end + args_p->stack_limit);
-  }
-  else
+#if (JERRY_VM_STACK_SIZE != 0)
+  /* The frame is pushed onto the VM stack, and it is popped by restoring the top. */
+  size_t stack_top = JERRY_CONTEXT (vm_stack_top);
+
+  if (JERRY_UNLIKELY (frame_size > VM_STACK_WORD_COUNT - stack_top))
   {
-    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
-    frame_size = (size_t) (args_p->register_end + args_p->stack_limit);
+    return ecma_raise_range_error (ECMA_ERR_MSG ("Maximum call stack size exceeded."));
   }
 
-  frame_size = frame_size * sizeof (ecma_value_t) + sizeof (vm_frame_ctx_t);
-  frame_size = (frame_size + sizeof (uintptr_t) - 1) / sizeof (uintptr_t);
+  frame_ctx_p = (vm_frame_ctx_t *) (JERRY_CONTEXT (vm_stack) + stack_top);
+  JERRY_CONTEXT (vm_stack_top) = stack_top + frame_size;
 
+  frame_ctx_p->bytecode_header_p = bytecode_header_p;
+  frame_ctx_p->lex_env_p = lex_env_p;
+  frame_ctx_p->this_binding = this_binding_value;
+
+  vm_init_exec (frame_ctx_p, arg_list_p, arg_list_len);
+
+  ecma_value_t completion_value = vm_execute (frame_ctx_p);
+
+  JERRY_ASSERT (JERRY_CONTEXT (vm_stack_top) == stack_top + frame_size);
+  JERRY_CONTEXT (vm_stack_top) = stack_top;
+  return completion_value;
+#else /* JERRY_VM_STACK_SIZE == 0 */
   /* Use JERRY_MAX() to avoid array declaration with size 0. */
 #if defined(JERRY_FOR_IAR_CONFIG)
   stack = (ecma_value_t*)jerry_vla_malloc (sizeof(ecma_value_t) * frame_size);
@@ -4490,6 +5262,7 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
 #else
   return vm_execute (frame_ctx_p);
 #endif
+#endif /* (JERRY_VM_STACK_SIZE != 0) */
 } /* vm_run */
 
 /**
@@ -196,6 +196,16 @@ typedef enum
   VM_OC_GREATER_EQUAL,           /**< greater equal */
   VM_OC_IN,                      /**< in */
   VM_OC_INSTANCEOF,              /**< instanceof */
+#if ENABLED (JERRY_VM_SUPERINSTRUCTIONS)
+  VM_OC_STRICT_EQUAL_AND_BRANCH, /**< strict equal and branch */
+  VM_OC_STRICT_NOT_EQUAL_AND_BRANCH, /**< strict not equal and branch */
+
+  /* These four opcodes must be in this order. */
+  VM_OC_LESS_AND_BRANCH,         /**< less and branch */
+  VM_OC_GREATER_AND_BRANCH,      /**< greater and branch */
+  VM_OC_LESS_EQUAL_AND_BRANCH,   /**< less equal and branch */
+  VM_OC_GREATER_EQUAL_AND_BRANCH, /**< greater equal and branch */
+#endif /* ENABLED (JERRY_VM_SUPERINSTRUCTIONS) */
 
   VM_OC_BIT_OR,                  /**< bitwise or */
   VM_OC_BIT_XOR,                 /**< bitwise xor */
@@ -298,6 +308,14 @@ typedef enum
 #if !ENABLED (JERRY_LINE_INFO) && !ENABLED (JERRY_ES2015_MODULE_SYSTEM)
   VM_OC_RESOURCE_NAME = VM_OC_NONE,           /**< resource name of the current function is unused */
 #endif /* !ENABLED (JERRY_LINE_INFO) && !ENABLED (JERRY_ES2015_MODULE_SYSTEM) */
+#if !ENABLED (JERRY_VM_SUPERINSTRUCTIONS)
+  VM_OC_STRICT_EQUAL_AND_BRANCH = VM_OC_NONE, /**< strict equal and branch is unused */
+  VM_OC_STRICT_NOT_EQUAL_AND_BRANCH = VM_OC_NONE, /**< strict not equal and branch is unused */
+  VM_OC_LESS_AND_BRANCH = VM_OC_NONE,         /**< less and branch is unused */
+  VM_OC_GREATER_AND_BRANCH = VM_OC_NONE,      /**< greater and branch is unused */
+  VM_OC_LESS_EQUAL_AND_BRANCH = VM_OC_NONE,   /**< less equal and branch is unused */
+  VM_OC_GREATER_EQUAL_AND_BRANCH = VM_OC_NONE, /**< greater equal and branch is unused */
+#endif /* !ENABLED (JERRY_VM_SUPERINSTRUCTIONS) */
 #if !ENABLED (JERRY_LINE_INFO)
   VM_OC_LINE = VM_OC_NONE,                    /**< line number of the next statement is unused */
 #endif /* !ENABLED (JERRY_LINE_INFO) */
@@ -377,6 +395,16 @@ typedef enum
  */
 #define VM_OC_LOGICAL_BRANCH_FLAG 0x2
 
+/**
+ * The operands of the relational superinstruction are swapped.
+ */
+#define VM_OC_COMPARE_AND_BRANCH_SWAP_FLAG 0x1
+
+/**
+ * The relational superinstruction also accepts equal operands.
+ */
+#define VM_OC_COMPARE_AND_BRANCH_OR_EQUAL_FLAG 0x2
+
 /**
  * Bit index shift for non-static property initializers.
  */
@@ -450,6 +478,31 @@ bool vm_is_direct_eval_form_call (void);
 
 ecma_value_t vm_get_backtrace (uint32_t max_depth);
 
+#if ENABLED (JERRY_VM_PROFILER)
+
+/**
+ * Maximum number of frames passed to the profiler callback (the innermost frames are kept).
+ */
+#define VM_PROFILER_MAX_DEPTH 32
+
+void vm_profiler_sample (const vm_frame_ctx_t *frame_ctx_p, const uint8_t *byte_code_p);
+
+/**
+ * Count a profiler event and take a sample when the sampling interval elapsed.
+ */
+#define VM_PROFILER_TICK(frame_ctx_p, byte_code_p) \
+  do \
+  { \
+    if (JERRY_UNLIKELY (JERRY_CONTEXT (vm_profile_cb) != NULL) \
+        && --JERRY_CONTEXT (vm_profile_counter) == 0) \
+    { \
+      vm_profiler_sample ((frame_ctx_p), (byte_code_p)); \
+    } \
+  } \
+  while (0)
+
+#endif /* ENABLED (JERRY_VM_PROFILER) */
+
 /**
  * @}
  * @}
@@ -309,6 +309,160 @@ wait_for_source_callback (const jerry_char_t *resource_name_p, /**< resource nam
   return ret_val;
 } /* wait_for_source_callback */
 
+#if defined (JERRY_VM_PROFILER) && (JERRY_VM_PROFILER == 1)
+
+/**
+ * Maximum number of different stacks collected by the sampling profiler
+ */
+#define PROFILE_TABLE_SIZE 1024
+
+/**
+ * Maximum length of a collected stack
+ */
+#define PROFILE_STACK_SIZE 512
+
+/**
+ * Stack collected by the sampling profiler
+ */
+typedef struct
+{
+  char stack[PROFILE_STACK_SIZE]; /**< frames of the stack separated by ';' */
+  uint32_t count; /**< number of samples of the stack (0 for unused entries) */
+} profile_entry_t;
+
+/**
+ * Stacks collected by the sampling profiler (allocated when the profiler is used)
+ */
+static profile_entry_t *profile_table_p = NULL;
+
+/**
+ * Output file of the sampling profiler (NULL if the profiler is not used)
+ */
+static const char *profile_file_name = NULL;
+
+/**
+ * Append the name of a sampled frame to a stack.
+ *
+ * @return new length of the stack
+ */
+static size_t
+profile_append_frame (char *stack_p, /**< stack */
+                      size_t length, /**< current length of the stack */
+                      const jerry_vm_profile_frame_t *frame_p) /**< sampled frame */
+{
+  char name[128];
+
+  if (jerry_value_is_string (frame_p->resource_name))
+  {
+    jerry_size_t name_size = jerry_substring_to_utf8_char_buffer (frame_p->resource_name,
+                                                                  0,
+                                                                  jerry_get_utf8_string_length (frame_p->resource_name),
+                                                                  (jerry_char_t *) name,
+                                                                  sizeof (name) - 1);
+    name[name_size] = '\0';
+  }
+  else
+  {
+    snprintf (name, sizeof (name), "%p", frame_p->function_p);
+  }
+
+  int size;
+
+  if (frame_p->line != 0)
+  {
+    size = snprintf (stack_p + length, PROFILE_STACK_SIZE - length, "%s%s:%u",
+                     length > 0 ? ";" : "", name, (unsigned int) frame_p->line);
+  }
+  else
+  {
+    size = snprintf (stack_p + length, PROFILE_STACK_SIZE - length, "%s%s+%u",
+                     length > 0 ? ";" : "", name, (unsigned int) frame_p->byte_offset);
+  }
+
+  if (size < 0 || (size_t) size >= PROFILE_STACK_SIZE - length)
+  {
+    return PROFILE_STACK_SIZE - 1;
+  }
+
+  return length + (size_t) size;
+} /* profile_append_frame */
+
+/**
+ * Sampling profiler callback which counts the samples of each stack.
+ */
+static void
+profile_callback (const jerry_vm_profile_frame_t *frames_p, /**< sampled frames */
+                  uint32_t frame_count, /**< number of frames */
+                  void *user_p) /**< user pointer */
+{
+  (void) user_p; /* unused */
+
+  char stack[PROFILE_STACK_SIZE];
+  size_t length = 0;
+
+  for (uint32_t i = 0; i < frame_count && length < PROFILE_STACK_SIZE - 1; i++)
+  {
+    length = profile_append_frame (stack, length, frames_p + i);
+  }
+
+  stack[length] = '\0';
+
+  /* FNV-1a hash of the stack. */
+  uint32_t hash = 2166136261u;
+
+  for (size_t i = 0; i < length; i++)
+  {
+    hash = (hash ^ (uint8_t) stack[i]) * 16777619u;
+  }
+
+  for (uint32_t i = 0; i < PROFILE_TABLE_SIZE; i++)
+  {
+    profile_entry_t *entry_p = profile_table_p + ((hash + i) % PROFILE_TABLE_SIZE);
+
+    if (entry_p->count == 0)
+    {
+      memcpy (entry_p->stack, stack, length + 1);
+      entry_p->count = 1;
+      return;
+    }
+
+    if (strcmp (entry_p->stack, stack) == 0)
+    {
+      entry_p->count++;
+      return;
+    }
+  }
+
+  /* The table is full: the sample is dropped. */
+} /* profile_callback */
+
+/**
+ * Write the collected stacks in the folded format ("frame;frame;frame count" lines).
+ */
+static void
+profile_write (const char *file_name) /**< output file */
+{
+  FILE *file = fopen (file_name, "w");
+
+  if (file == NULL)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to open file: %s\n", file_name);
+    return;
+  }
+
+  for (uint32_t i = 0; i < PROFILE_TABLE_SIZE; i++)
+  {
+    if (profile_table_p[i].count != 0)
+    {
+      fprintf (file, "%s %u\n", profile_table_p[i].stack, (unsigned int) profile_table_p[i].count);
+    }
+  }
+
+  fclose (file);
+} /* profile_write */
+
+#endif /* defined (JERRY_VM_PROFILER) && (JERRY_VM_PROFILER == 1) */
+
 /**
  * Command line option IDs
  */
@@ -330,7 +484,10 @@ typedef enum
   OPT_EXEC_SNAP_FUNC,
   OPT_LOG_LEVEL,
   OPT_NO_PROMPT,
-  OPT_CALL_ON_EXIT
+  OPT_CALL_ON_EXIT,
+#if defined (JERRY_VM_PROFILER) && (JERRY_VM_PROFILER == 1)
+  OPT_PROFILE,
+#endif /* defined (JERRY_VM_PROFILER) && (JERRY_VM_PROFILER == 1) */
 } main_opt_id_t;
 
 /**
@@ -372,6 +529,10 @@ static const cli_opt_t main_opts[] =
                .help = "don't print prompt in REPL mode"),
   CLI_OPT_DEF (.id = OPT_CALL_ON_EXIT, .longopt = "call-on-exit", .meta = "STRING",
                .help = "invoke the specified function when the process is just about to exit"),
+#if defined (JERRY_VM_PROFILER) && (JERRY_VM_PROFILER == 1)
+  CLI_OPT_DEF (.id = OPT_PROFILE, .longopt = "profile", .meta = "FILE",
+               .help = "write the stacks sampled by the profiler to FILE in folded format"),
+#endif /* defined (JERRY_VM_PROFILER) && (JERRY_VM_PROFILER == 1) */
   CLI_OPT_DEF (.id = CLI_OPT_DEFAULT, .meta = "FILE",
                .help = "input JS file(s) (If file is -, read standard input.)")
 };
@@ -467,6 +628,13 @@ init_engine (jerry_init_flag_t flags, /**< initialized flags for the engine */
   register_js_function ("gc", jerryx_handler_gc);
   register_js_function ("print", jerryx_handler_print);
   register_js_function ("resourceName", jerryx_handler_resource_name);
+
+#if defined (JERRY_VM_PROFILER) && (JERRY_VM_PROFILER == 1)
+  if (profile_file_name != NULL)
+  {
+    jerry_set_vm_profile_callback (profile_callback, NULL, 1000);
+  }
+#endif /* defined (JERRY_VM_PROFILER) && (JERRY_VM_PROFILER == 1) */
 } /* init_engine */
 
 int
@@ -650,6 +818,29 @@ main (int argc,
         no_prompt = true;
         break;
       }
+#if defined (JERRY_VM_PROFILER) && (JERRY_VM_PROFILER == 1)
+      case OPT_PROFILE:
+      {
+        const char *file_name = cli_consume_string (&cli_state);
+
+        if (check_feature (JERRY_FEATURE_VM_PROFILER, cli_state.arg) && profile_table_p == NULL)
+        {
+          profile_table_p = (profile_entry_t *) calloc (PROFILE_TABLE_SIZE, sizeof (profile_entry_t));
+
+          if (profile_table_p == NULL)
+          {
+            jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to allocate the profiler table\n");
+            return JERRY_STANDALONE_EXIT_CODE_FAIL;
+          }
+        }
+
+        if (profile_table_p != NULL)
+        {
+          profile_file_name = file_name;
+        }
+        break;
+      }
+#endif /* defined (JERRY_VM_PROFILER) && (JERRY_VM_PROFILER == 1) */
       case CLI_OPT_DEFAULT:
       {
         file_names[files_counter++] = cli_consume_string (&cli_state);
@@ -995,5 +1186,14 @@ main (int argc,
 #if defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1)
   free (context_p);
 #endif /* defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1) */
+
+#if defined (JERRY_VM_PROFILER) && (JERRY_VM_PROFILER == 1)
+  if (profile_file_name != NULL)
+  {
+    profile_write (profile_file_name);
+    free (profile_table_p);
+  }
+#endif /* defined (JERRY_VM_PROFILER) && (JERRY_VM_PROFILER == 1) */
+
   return ret_code;
 } /* main */
@@ -0,0 +1,113 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif /* HAVE_PTHREAD_H */
+
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+
+#ifdef HAVE_PTHREAD_H
+
+/**
+ * Maximum number of workers started by jerry_port_run_parallel.
+ */
+#define JERRY_PORT_DEFAULT_MAX_WORKERS 64
+
+/**
+ * Arguments of a worker thread.
+ */
+typedef struct
+{
+  jerry_port_parallel_task_t task_p; /**< task to run */
+  void *data_p; /**< data pointer of the task */
+  uint32_t worker_index; /**< index of the worker */
+} jerry_port_default_worker_t;
+
+/**
+ * Entry point of the worker threads.
+ *
+ * @return NULL
+ */
+static void *
+jerry_port_default_worker_thread (void *arg_p) /**< worker arguments */
+{
+  jerry_port_default_worker_t *worker_p = (jerry_port_default_worker_t *) arg_p;
+
+  worker_p->task_p (worker_p->data_p, worker_p->worker_index);
+  return NULL;
+} /* jerry_port_default_worker_thread */
+
+/**
+ * Default implementation of jerry_port_run_parallel. The calling thread runs the
+ * first worker, and a POSIX thread is started for each other worker.
+ */
+void
+jerry_port_run_parallel (jerry_port_parallel_task_t task_p, /**< task to run */
+                         void *data_p, /**< data pointer of the task */
+                         uint32_t worker_count) /**< number of workers */
+{
+  pthread_t threads[JERRY_PORT_DEFAULT_MAX_WORKERS];
+  jerry_port_default_worker_t workers[JERRY_PORT_DEFAULT_MAX_WORKERS];
+  uint32_t started_count = 1;
+
+  if (worker_count > JERRY_PORT_DEFAULT_MAX_WORKERS)
+  {
+    worker_count = JERRY_PORT_DEFAULT_MAX_WORKERS;
+  }
+
+  while (started_count < worker_count)
+  {
+    jerry_port_default_worker_t *worker_p = workers + started_count;
+
+    worker_p->task_p = task_p;
+    worker_p->data_p = data_p;
+    worker_p->worker_index = started_count;
+
+    if (pthread_create (threads + started_count, NULL, jerry_port_default_worker_thread, worker_p) != 0)
+    {
+      /* The engine finishes the work of the workers which are not started. */
+      break;
+    }
+
+    started_count++;
+  }
+
+  task_p (data_p, 0);
+
+  for (uint32_t i = 1; i < started_count; i++)
+  {
+    pthread_join (threads[i], NULL);
+  }
+} /* jerry_port_run_parallel */
+
+#else /* !HAVE_PTHREAD_H */
+
+/**
+ * Default implementation of jerry_port_run_parallel. Threads are not available,
+ * so no worker is started and the engine does the work on the calling thread.
+ */
+void
+jerry_port_run_parallel (jerry_port_parallel_task_t task_p, /**< task to run */
+                         void *data_p, /**< data pointer of the task */
+                         uint32_t worker_count) /**< number of workers */
+{
+  (void) task_p;
+  (void) data_p;
+  (void) worker_count;
+} /* jerry_port_run_parallel */
+
+#endif /* HAVE_PTHREAD_H */
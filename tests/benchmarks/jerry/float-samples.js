@@ -0,0 +1,51 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Smooths quantized sensor readings (fixed point values with a binary
+ * fraction) and interpolates positions in quarter steps. Every intermediate
+ * non-integer result is a heap allocated number, unless it can be encoded
+ * directly (compare builds with and without --direct-float). */
+
+var samples = [];
+
+for (var i = 0; i < 256; i++)
+{
+  samples.push (((i * 37) % 1024) / 16 - 20);
+}
+
+var rounds = 200;
+var total = 0;
+
+for (var k = 0; k < rounds; k++)
+{
+  var average = samples[0];
+
+  for (var i = 1; i < samples.length; i++)
+  {
+    average = (average * 3 + samples[i]) / 4;
+    average = Math.round (average * 64) / 64;
+  }
+
+  var position = -0.5;
+
+  for (var step = 0; step < 256; step++)
+  {
+    position += 0.25;
+  }
+
+  total += average + position;
+}
+
+assert (total === rounds * (average + position));
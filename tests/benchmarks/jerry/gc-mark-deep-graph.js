@@ -0,0 +1,33 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Builds a fresh deep object chain before every full garbage collection,
+ * so the run time is dominated by marking objects in allocation order.
+ * The mark time should grow linearly with the number of live objects. */
+
+var live_objects = 600;
+
+for (var k = 0; k < 100; k++)
+{
+  var chain = {};
+  var chain_last = chain;
+
+  for (var i = 0; i < live_objects; i++)
+  {
+    chain_last.next = {};
+    chain_last = chain_last.next;
+  }
+
+  gc ();
+}
@@ -0,0 +1,37 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Allocates and frees many short strings and small objects while a set of
+ * long lived blocks keeps the free region list fragmented. Most heap blocks
+ * are 9 - 24 bytes long, so the run time is dominated by the allocator path
+ * of small blocks (compare builds with and without --mem-slab-allocator). */
+
+var live = [];
+
+for (var i = 0; i < 200; i++)
+{
+  live.push ("live" + i);
+}
+
+for (var k = 0; k < 1000; k++)
+{
+  var temp = [];
+
+  for (var j = 0; j < 100; j++)
+  {
+    temp.push ({ a: j, b: "s" + j });
+  }
+
+  live[k % live.length] = "live" + k;
+}
@@ -0,0 +1,41 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Parses a data table script which contains thousands of distinct float
+ * constants spread over many small functions. Each constant is looked up in
+ * the literal storage, so the parse time is dominated by the number literal
+ * search (compare builds with and without --lit-hash-table). */
+
+var parts = [];
+
+for (var i = 0; i < 400; i++)
+{
+  var row = [];
+
+  for (var j = 0; j < 8; j++)
+  {
+    row.push ((i * 8 + j) + 0.25);
+  }
+
+  parts.push ("function row" + i + " () { return [" + row.join (", ") + "]; }");
+}
+
+var source = parts.join ("\n");
+
+for (var k = 0; k < 10; k++)
+{
+  var f = new Function (source);
+  f ();
+}
@@ -0,0 +1,35 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Parses many small functions which contain thousands of distinct string
+ * literals and property names in total. Each literal is looked up in the
+ * literal storage, so the parse time is dominated by the literal search
+ * (compare builds with and without --lit-hash-table). */
+
+var parts = [];
+
+for (var i = 0; i < 300; i++)
+{
+  parts.push ("function f" + i + " (o) { return o.key_" + i + "_a + o.key_" + i + "_b + 'value_" + i
+              + "_c' + 'value_" + i + "_d' + o.key_" + i + "_e + 'value_" + i + "_f'; }");
+}
+
+var source = parts.join ("\n");
+
+for (var k = 0; k < 10; k++)
+{
+  var f = new Function (source);
+  f ();
+}
@@ -0,0 +1,30 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Divides integers by integers, where most of the quotients are exact,
+ * and divides a float by integers, so the run time is dominated by the
+ * fast paths of the division opcode. */
+
+var count = 1000000;
+var a = 4096;
+var b = 0.5;
+var d = 0;
+
+for (var i = 1; i < count; i++)
+{
+  d = (i * 4) / 2;
+  d = a / 8;
+  d = a / 3;
+  d = b / 2;
+}
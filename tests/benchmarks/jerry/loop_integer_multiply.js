@@ -0,0 +1,25 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Multiplies integers whose products exceed the old small operand limit
+ * (0x2d41) but still fit into an int32, so every product is computed by
+ * the integer fast path of the multiplication opcode. */
+
+var count = 3000000;
+var s = 0;
+
+for (var i = 1; i < count; i++)
+{
+  s = (i * 20000) & 0xffff;
+}
@@ -0,0 +1,59 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Executes a long stream of cheap, varied opcodes on register variables,
+ * so the run time is dominated by the opcode dispatch of the interpreter
+ * rather than by the work of the individual opcodes. */
+
+function dispatch (count)
+{
+  var a = 1;
+  var b = 2;
+  var c = 0;
+  var flag = false;
+  var point = { x: 3, y: 4 };
+
+  for (var i = 0; i < count; i++)
+  {
+    c = a + b;
+    c = c - a;
+    c = c & 0xff;
+    c = c | 1;
+    c = c ^ b;
+    c = c << 1;
+    c = c >> 1;
+    flag = !flag;
+
+    if (flag)
+    {
+      a = point.x;
+    }
+    else
+    {
+      a = point.y;
+    }
+
+    if (c < a || c === b)
+    {
+      b = b === 2 ? 3 : 2;
+    }
+
+    point.x = a;
+    c = typeof c === "number" ? c : 0;
+  }
+
+  return a + b + c;
+}
+
+dispatch (300000);
@@ -0,0 +1,94 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Comparisons followed by conditional branches must give the same
+ * results as comparisons whose result is stored in a value. */
+var values = [1, 2, 2.5, NaN, -0, 0, "3", "10", "9", null, undefined, true,
+              { valueOf: function () { return 2; } }, 1e100, -Infinity];
+
+function compare (a, b) {
+  var results = [a < b, a > b, a <= b, a >= b, a === b, a !== b];
+  return results.join();
+}
+
+for (var i = 0; i < values.length; i++) {
+  for (var j = 0; j < values.length; j++) {
+    var a = values[i];
+    var b = values[j];
+    var results = [];
+
+    if (a < b) results.push(true); else results.push(false);
+    if (a > b) results.push(true); else results.push(false);
+    if (a <= b) results.push(true); else results.push(false);
+    if (a >= b) results.push(true); else results.push(false);
+    if (a === b) results.push(true); else results.push(false);
+    if (a !== b) results.push(true); else results.push(false);
+    assert (results.join() === compare (a, b));
+
+    results = [];
+    if (values[i] < values[j]) results.push(true); else results.push(false);
+    if (values[i] > values[j]) results.push(true); else results.push(false);
+    if (values[i] <= values[j]) results.push(true); else results.push(false);
+    if (values[i] >= values[j]) results.push(true); else results.push(false);
+    if (values[i] === values[j]) results.push(true); else results.push(false);
+    if (values[i] !== values[j]) results.push(true); else results.push(false);
+    assert (results.join() === compare (a, b));
+
+    var expected = compare (a, b).split(",");
+    assert ((a < b ? "true" : "false") === expected[0]);
+    assert ((a >= b ? "true" : "false") === expected[3]);
+    assert ((a !== b ? "true" : "false") === expected[5]);
+  }
+}
+
+/* Backward branches. */
+var k = 0;
+do {
+  k++;
+} while (k <= 300);
+assert (k === 301);
+
+k = 500;
+while (k > 0.5) {
+  k -= 1;
+}
+assert (k === 0);
+
+k = 0;
+for (var s = "a"; s !== "aaaa"; s += "a") {
+  k++;
+}
+assert (k === 3);
+
+/* The operands are converted in the right order. */
+var order = [];
+var x = { valueOf: function () { order.push ("x"); return 1; } };
+var y = { valueOf: function () { order.push ("y"); return 2; } };
+
+if (x > y) { order.push ("!"); }
+if (x >= y) { order.push ("!"); }
+if (x <= y) { order.push ("<="); }
+if (x < y) { order.push ("<"); }
+assert (order.join ("") === "xyxyxy<=xy<");
+
+/* Errors thrown by the conversion are not lost. */
+var caught = 0;
+try {
+  if ({ valueOf: function () { throw 5; } } < 1) {
+    caught = 1;
+  }
+} catch (e) {
+  caught = e;
+}
+assert (caught === 5);
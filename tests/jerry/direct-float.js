@@ -0,0 +1,115 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function same_value (a, b)
+{
+  var obj = {};
+  Object.defineProperty (obj, "value", { value: a });
+
+  try
+  {
+    Object.defineProperty (obj, "value", { value: b });
+    return true;
+  }
+  catch (e)
+  {
+    assert (e instanceof TypeError);
+    return false;
+  }
+}
+
+/* Numbers which fit into a short float and numbers which do not. */
+var values = [0.5, -12.375, 1.5e30, 0.1, 1 / 3, 123456789.5, 2147483648, -0, Infinity, -Infinity];
+
+for (var i = 0; i < values.length; i++)
+{
+  var x = values[i];
+  var y = x;
+
+  assert (x === y);
+  assert (x == y);
+  assert (!(x !== y));
+  assert (String (x * 2) === String (values[i] * 2));
+  assert (x / 2 * 2 === x);
+}
+
+assert (1 / -0 === -Infinity);
+assert (1 / (0.5 - 0.5) === Infinity);
+assert (1 / (-0.5 * 0) === -Infinity);
+assert (0.5 + 0.25 === 0.75);
+assert (0.1 + 0.2 !== 0.3);
+assert (String (0.1 + 0.2) === "0.30000000000000004");
+assert (0.5 * 4 === 2);
+assert (-12.375 + 12.375 === 0);
+
+/* Increments cross between the encodings. */
+var f = 0.5;
+f++;
+assert (f === 1.5);
+f += 0.1;
+assert (f === 1.6);
+f -= 0.1;
+assert (f === 1.5);
+f = 1e38;
+f *= 10;
+assert (f === 1e39);
+f = 3.5;
+f--;
+f--;
+assert (f === 1.5);
+
+/* NaN is never equal to itself. */
+var n = 0 / 0;
+var m = n;
+assert (n !== m);
+assert (!(n == m));
+assert (n != n);
+assert (isNaN (n));
+assert ([n].indexOf (n) === -1);
+
+var obj = { a: 0.75, b: 0.1 };
+obj.a = obj.b;
+assert (obj.a === 0.1);
+obj.b = 0.75;
+assert (obj.b === 0.75);
+obj.a += 0.65;
+assert (obj.a === 0.75);
+obj.b = -0;
+assert (1 / obj.b === -Infinity);
+
+/* NaN values with a payload. */
+var bytes = new Uint8Array ([1, 0, 0, 0, 0, 0, 0xf8, 0x7f]);
+var nan_payload = new Float64Array (bytes.buffer)[0];
+assert (isNaN (nan_payload));
+assert (nan_payload !== n);
+assert (same_value (nan_payload, n));
+assert (same_value (n, nan_payload));
+
+assert (same_value (-0, -0));
+assert (!same_value (-0, 0));
+assert (same_value (0.5, 0.25 * 2));
+
+var arr = new Float32Array ([0.5, 0.1, -0]);
+assert (arr[0] === 0.5);
+assert (arr[1] !== 0.1);
+assert (arr[1] === new Float32Array ([0.1])[0]);
+assert (1 / arr[2] === -Infinity);
+
+switch (0.25 + 0.25)
+{
+  case 0.5:
+    break;
+  default:
+    assert (false);
+}
@@ -0,0 +1,114 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Calls between byte code functions. */
+function count (n) {
+  return n == 0 ? 0 : 1 + count (n - 1);
+}
+
+assert (count (300) === 300);
+
+/* Missing and extra arguments. */
+function args (a, b) {
+  return [a, b, arguments.length, arguments[2]].join ();
+}
+
+assert (args (1) === "1,,1,");
+assert (args (1, 2, 3) === "1,2,3,3");
+
+/* The this binding of non-strict and strict functions. */
+function sloppyThis () {
+  return typeof this;
+}
+
+function strictThis () {
+  "use strict";
+  return this;
+}
+
+var global = this;
+assert ((function () { return this; }) () === global);
+assert (sloppyThis.call (5) === "object");
+assert (strictThis () === undefined);
+
+var n = 5;
+n.strictThis = strictThis;
+Number.prototype.sloppyThis = sloppyThis;
+Number.prototype.strictThis = strictThis;
+assert (n.sloppyThis () === "object");
+assert (n.strictThis () === 5);
+
+var obj = {
+  value: 3,
+  get: function () { return this.value; },
+  twice: function () { return this.get () + this.get (); }
+};
+
+assert (obj.twice () === 6);
+
+/* Closures see the environment of the call. */
+function counter () {
+  var c = 0;
+  return function () { return ++c; };
+}
+
+var next = counter ();
+next ();
+assert (next () === 2);
+
+/* Exceptions leave the frames of the callees. */
+function thrower (depth) {
+  if (depth == 0) {
+    throw new RangeError ("done");
+  }
+  return thrower (depth - 1);
+}
+
+var finallyCount = 0;
+
+function guarded (depth) {
+  try {
+    return thrower (depth);
+  } finally {
+    finallyCount++;
+  }
+}
+
+try {
+  guarded (20);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+  assert (e.message === "done");
+}
+
+assert (finallyCount === 1);
+
+/* Results of calls which are not used. */
+var calls = 0;
+function inc () {
+  return ++calls;
+}
+
+inc ();
+inc ();
+assert (inc () === 3);
+
+/* Calls of native functions from byte code functions and the opposite. */
+function square (x) {
+  return x * x;
+}
+
+assert ([1, 2, 3].map (square).join () === "1,4,9");
+assert (Math.max (square (3), square (-4)) === 16);
@@ -0,0 +1,56 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* The frames of the callers must be intact after the callees return or throw. */
+function sum (n, a, b, c) {
+  var local = n * 2;
+  if (n === 0) {
+    return a + b + c;
+  }
+  var result = sum (n - 1, a + 1, b, c);
+  assert (local === n * 2);
+  return result + n;
+}
+
+assert (sum (64, 0, 1, 2) === 67 + 2080);
+
+function thrower (n) {
+  var local = [n];
+  if (n === 0) {
+    throw "bottom";
+  }
+  try {
+    thrower (n - 1);
+  } finally {
+    assert (local[0] === n);
+  }
+}
+
+for (var i = 0; i < 3; i++) {
+  try {
+    thrower (32);
+    assert (false);
+  } catch (e) {
+    assert (e === "bottom");
+  }
+}
+
+/* Native functions calling back into the engine. */
+var values = [5, 3, 9, 1];
+values.sort (function (a, b) {
+  return [a].map (function (x) { return x - b; })[0];
+});
+assert (values.join () === "1,3,5,9");
+
+assert (sum (64, 0, 1, 2) === 67 + 2080);
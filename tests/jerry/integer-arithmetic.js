@@ -0,0 +1,75 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function isNegativeZero (x) {
+  return x === 0 && 1 / x === -Infinity;
+}
+
+function isPositiveZero (x) {
+  return x === 0 && 1 / x === Infinity;
+}
+
+/* Multiplication of integers. */
+assert (12345 * 6789 === 83810205);
+assert (20000 * 20000 === 400000000);
+assert (-20000 * 20000 === -400000000);
+assert (65536 * 65536 === 4294967296);
+assert (134217727 * 134217727 === 18014398241046528);
+assert (-134217728 * -134217728 === 18014398509481984);
+assert (46341 * 46341 === 2147488281);
+assert (46340 * 46340 === 2147395600);
+assert (-46341 * 46341 === -2147488281);
+
+assert (isPositiveZero (0 * 5));
+assert (isPositiveZero (0 * 0));
+assert (isNegativeZero (0 * -5));
+assert (isNegativeZero (-5 * 0));
+assert (isPositiveZero (-0 * -5));
+
+for (var i = -100000; i <= 100000; i += 997) {
+  var product = i * 30011;
+  assert (product / 30011 === i);
+  assert ((i * 1.5) * 2 === i * 3);
+}
+
+/* Division of integers. */
+assert (84 / 4 === 21);
+assert (-84 / 4 === -21);
+assert (84 / -4 === -21);
+assert (7 / 2 === 3.5);
+assert (-7 / 2 === -3.5);
+assert (1 / 3 === 0.3333333333333333);
+assert (134217727 / 1 === 134217727);
+assert (-134217728 / -1 === 134217728);
+
+assert (isPositiveZero (0 / 5));
+assert (isNegativeZero (0 / -5));
+assert (5 / 0 === Infinity);
+assert (-5 / 0 === -Infinity);
+assert (isNaN (0 / 0));
+
+/* Mixed integer and float operands. */
+var half = 0.5;
+assert (3 / half === 6);
+assert (half / 2 === 0.25);
+assert (half / 0.25 === 2);
+assert (isNegativeZero (0 / -half));
+assert (isNaN (half / "x"));
+assert (6 / "3" === 2);
+
+var sum = 0;
+for (var i = 1; i <= 100; i++) {
+  sum += (i * i) / i;
+}
+assert (sum === 5050);
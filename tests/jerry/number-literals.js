@@ -0,0 +1,42 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Zero and negative zero are different literals. */
+function zeros () {
+  return [0.0, -0.0, -0, 0];
+}
+
+var z = zeros ();
+assert (1 / z[0] === Infinity);
+assert (1 / z[1] === -Infinity);
+assert (1 / z[2] === -Infinity);
+assert (1 / z[3] === Infinity);
+
+/* Many distinct and repeated float literals. */
+var table = [0.5, 1.25, 2.125, 3.0625, 0.1, 0.2, 0.3, 1e300, -1e-300, 5e-324,
+             0.5, 1.25, 2.125, 3.0625, 0.1, 0.2, 0.3, 1e300, -1e-300, 5e-324];
+
+for (var i = 0; i < 10; i++) {
+  assert (table[i] === table[i + 10]);
+}
+
+assert (table[4] + table[5] !== table[6]);
+assert (table[9] > 0 && table[9] / 2 === 0);
+
+function floats () {
+  return 1.5 + 2.5 + 1.5 + 0.1 + 0.1;
+}
+
+assert (floats () === 1.5 + 2.5 + 1.5 + 0.1 + 0.1);
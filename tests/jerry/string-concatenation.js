@@ -0,0 +1,82 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Long strings built by repeated concatenation. */
+function build (count, piece) {
+  var s = "";
+  for (var i = 0; i < count; i++) {
+    s += piece + i;
+  }
+  return s;
+}
+
+var a = build (200, "item");
+var b = build (200, "item");
+
+assert (a.length === b.length);
+assert (a === b);
+assert (a.indexOf ("item199") === a.length - 7);
+assert (a.charAt (4) === "0");
+assert (a.substring (0, 10) === "item0item1");
+assert (a.slice (-7) === "item199");
+assert (a < a + "x");
+assert (!(a + "x" < a));
+
+/* Concatenations which share their parts. */
+var prefix = build (100, "p");
+var c1 = prefix + "c1";
+var c2 = prefix + "c2";
+assert (c1 !== c2);
+assert (c1.slice (0, prefix.length) === c2.slice (0, prefix.length));
+assert (c1.slice (-2) === "c1" && c2.slice (-2) === "c2");
+
+var twice = c1 + c1;
+assert (twice.length === 2 * c1.length);
+assert (twice.lastIndexOf (c1) === c1.length);
+
+var prepended = "";
+for (var i = 0; i < 100; i++) {
+  prepended = i + "," + prepended;
+}
+assert (prepended.split (",").length === 101);
+assert (prepended.slice (0, 6) === "99,98,");
+
+/* Long strings as property names. */
+var key1 = build (100, "key");
+var key2 = build (100, "key");
+var obj = {};
+obj[key1] = 1;
+assert (obj[key2] === 1);
+assert (key2 in obj);
+assert (Object.keys (obj)[0] === key1);
+obj[key2 + "!"] = 2;
+assert (obj[key1 + "!"] === 2);
+
+/* Non-ascii characters. */
+var unicode = "";
+for (var i = 0; i < 300; i++) {
+  unicode += "á一";
+}
+assert (unicode.length === 600);
+assert (unicode.charCodeAt (599) === 0x4e00);
+assert (unicode.charAt (300) === "á");
+
+/* Conversions. */
+var digits = "";
+for (var i = 0; i < 300; i++) {
+  digits += "1";
+}
+assert (Number (digits + "e-299") === 1.1111111111111112);
+assert (JSON.parse (JSON.stringify (a)) === a);
+assert (String (a) === a);
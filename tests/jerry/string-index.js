@@ -0,0 +1,67 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Characters of long non-ASCII strings accessed by their index. */
+var units = "aé中😀";
+var text = "";
+for (var i = 0; i < 200; i++) {
+  text += units.charAt (i % 5) + (i % 10);
+}
+
+assert (text.length === 400);
+
+for (var i = 0; i < 400; i++) {
+  var code = text.charCodeAt (i);
+  if (i % 2 === 1) {
+    assert (code === 48 + ((i >> 1) % 10));
+  } else {
+    assert (code === units.charCodeAt ((i >> 1) % 5));
+    assert (text[i] === units[(i >> 1) % 5]);
+  }
+}
+
+/* Backward and random accesses. */
+for (var i = 399; i >= 0; i -= 7) {
+  assert (text.charAt (i) === text.substring (i, i + 1));
+}
+
+for (var i = 0; i < 400; i += 31) {
+  assert (text.slice (i, i + 40) === text.substr (i, 40));
+  assert (text.indexOf (text.substring (i, i + 6), i) === i);
+}
+
+assert (text.substring (390) === "a5é6中7\ud83d8\ude009");
+
+var pairs = "";
+for (var i = 0; i < 200; i++) {
+  pairs += units.charAt (i % 5);
+}
+
+assert (pairs.charCodeAt (193) === 0xd83d);
+assert (pairs.charCodeAt (194) === 0xde00);
+assert (pairs.indexOf ("a", 100) === 100);
+assert (pairs.lastIndexOf ("中") === 197);
+
+/* Several indexed strings at the same time. */
+var strings = [];
+for (var i = 0; i < 10; i++) {
+  strings.push (text.substring (i * 4, 400));
+}
+
+for (var j = 0; j < 3; j++) {
+  for (var i = 0; i < 10; i++) {
+    assert (strings[i].charCodeAt (300) === text.charCodeAt (i * 4 + 300));
+  }
+}
@@ -0,0 +1,106 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Binary operations whose result is assigned to an identifier must give the
+ * same results as binary operations whose result is pushed onto the stack. */
+var values = [7, -3, 2.5, NaN, -0, "3", "x", null, undefined, true, 1e100,
+              { valueOf: function () { return 2; } }];
+
+function pushed (a, b) {
+  return [a | b, a ^ b, a & b, a == b, a != b, a === b, a !== b, a < b, a > b, a <= b,
+          a >= b, a << b, a >> b, a >>> b, a + b, a - b, a * b, a / b, a % b];
+}
+
+function assigned (a, b) {
+  var r0 = a | b, r1 = a ^ b, r2 = a & b, r3 = a == b, r4 = a != b, r5 = a === b, r6 = a !== b;
+  var r7, r8, r9, r10, r11, r12, r13, r14, r15, r16, r17, r18;
+  r7 = a < b; r8 = a > b; r9 = a <= b; r10 = a >= b; r11 = a << b; r12 = a >> b;
+  r13 = a >>> b; r14 = a + b; r15 = a - b; r16 = a * b; r17 = a / b; r18 = a % b;
+  return [r0, r1, r2, r3, r4, r5, r6, r7, r8, r9, r10, r11, r12, r13, r14, r15, r16, r17, r18];
+}
+
+function same (x, y) {
+  return x === y || (x !== x && y !== y);
+}
+
+for (var i = 0; i < values.length; i++) {
+  for (var j = 0; j < values.length; j++) {
+    var expected = pushed (values[i], values[j]);
+    var results = assigned (values[i], values[j]);
+
+    for (var k = 0; k < expected.length; k++) {
+      assert (same (results[k], expected[k]));
+    }
+  }
+}
+
+/* Stack and literal operands, global and register destinations. */
+var g;
+var o = { a: 1.5, b: 4 };
+
+g = o.a * o.b;
+assert (g === 6);
+g = o.a + 1;
+assert (g === 2.5);
+g = g - 0.5;
+assert (g === 2);
+g += 3;
+assert (g === 5);
+
+function sum (n) {
+  var s = 0.5;
+  for (var i = 0; i < n; i++) {
+    s = s + i;
+  }
+  return s;
+}
+
+assert (sum (10) === 45.5);
+
+/* The result of the assignment is used. */
+function chain (a, b) {
+  var x, y;
+  y = (x = a + b) * 2;
+  return [x, y, (x = a - b)].join ();
+}
+
+assert (chain (3, 1) === "4,8,2");
+
+/* The operands are converted before the assignment. */
+var log = [];
+var left = { valueOf: function () { log.push ("left"); return 5; } };
+var right = { valueOf: function () { log.push ("right"); return 6; } };
+var t = left * right;
+assert (t === 30);
+assert (log.join () === "left,right");
+
+/* Failing assignments and operations. */
+try {
+  (function () {
+    "use strict";
+    undeclared = 1.5 + 2.25;
+  }) ();
+  assert (false);
+} catch (err) {
+  assert (err instanceof ReferenceError);
+}
+
+var u = 1;
+try {
+  u = { valueOf: function () { throw 8; } } - 1;
+  assert (false);
+} catch (err) {
+  assert (err === 8);
+  assert (u === 1);
+}
@@ -0,0 +1,128 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+#include "test-common.h"
+#include <gtest/gtest.h>
+
+static int native_data = 0;
+
+static const jerry_object_native_info_t native_info =
+{
+  .free_cb = NULL
+};
+
+static const char *fragment_script =
+  "var keep = [];\n"
+  "for (var i = 0; i < 40; i++) {\n"
+  "  var o = { index: i };\n"
+  "  for (var j = 0; j < 6; j++) { o['p' + j] = i * 10 + j; }\n"
+  "  keep.push (o);\n"
+  "  keep.push ([i, i + 1, i + 2]);\n"
+  "}\n"
+  "for (var i = 0; i < keep.length; i += 4) { keep[i] = null; }\n";
+
+static const char *check_script =
+  "var ok = true;\n"
+  "for (var i = 0; i < keep.length; i++) {\n"
+  "  var v = keep[i];\n"
+  "  if (i % 4 == 0) { ok = ok && v === null; continue; }\n"
+  "  var idx = (i - (i % 2)) / 2;\n"
+  "  if (i % 2 == 0) {\n"
+  "    ok = ok && v.index === idx;\n"
+  "    for (var j = 0; j < 6; j++) { ok = ok && v['p' + j] === idx * 10 + j; }\n"
+  "  } else {\n"
+  "    ok = ok && v[0] === idx && v[1] === idx + 1 && v[2] === idx + 2;\n"
+  "  }\n"
+  "}\n"
+  "ok;\n";
+
+static const char *update_script = "keep[1].extra = 5; keep[3].push (7); keep[1].extra + keep[3][3]";
+
+static bool
+run_check (void)
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) check_script, strlen (check_script), JERRY_PARSE_NO_OPTS);
+  bool ok = jerry_value_is_boolean (result) && jerry_get_boolean_value (result);
+  jerry_release_value (result);
+  return ok;
+} /* run_check */
+
+class GcCompactTest : public testing::Test{
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "GcCompactTest SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "GcCompactTest TearDownTestCase";
+    }
+
+    void SetUp() override {}
+    void TearDown() override {}
+
+};
+
+static constexpr size_t JERRY_SCRIPT_MEM_SIZE = 50 * 1024 * 1024;
+static void* context_alloc_fn(size_t size, void* cb_data)
+{
+    (void)cb_data;
+    size_t newSize = size > JERRY_SCRIPT_MEM_SIZE ? JERRY_SCRIPT_MEM_SIZE : size;
+    return malloc(newSize);
+}
+HWTEST_F(GcCompactTest, Test001, testing::ext::TestSize.Level1)
+{
+  jerry_context_t *ctx_p = jerry_create_context (64 * 1024, context_alloc_fn, NULL);
+  jerry_port_default_set_current_context (ctx_p);
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) fragment_script,
+                                     strlen (fragment_script),
+                                     JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (result));
+  jerry_release_value (result);
+
+  /* The native pointer is stored in a property pair which may be moved. */
+  jerry_value_t object = jerry_create_object ();
+  jerry_set_object_native_pointer (object, &native_data, &native_info);
+
+  /* Property lookups are cached before the blocks are moved. */
+  TEST_ASSERT (run_check ());
+
+  jerry_gc (JERRY_GC_PRESSURE_HIGH);
+  TEST_ASSERT (run_check ());
+
+  void *native_p = NULL;
+  TEST_ASSERT (jerry_get_object_native_pointer (object, &native_p, &native_info));
+  TEST_ASSERT (native_p == &native_data);
+
+  /* New properties and array elements can be added after the compaction. */
+  result = jerry_eval ((const jerry_char_t *) update_script, strlen (update_script), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (jerry_value_is_number (result) && jerry_get_number_value (result) == 12.0);
+  jerry_release_value (result);
+
+  jerry_gc (JERRY_GC_PRESSURE_HIGH);
+  TEST_ASSERT (run_check ());
+
+  jerry_release_value (object);
+  jerry_cleanup ();
+  free (ctx_p);
+}
@@ -0,0 +1,121 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+#include "test-common.h"
+#include <gtest/gtest.h>
+
+static int temp_free_count = 0;
+static int child_free_count = 0;
+
+static void
+free_temp (void *data_p) /**< native data */
+{
+  JERRY_UNUSED (data_p);
+  temp_free_count++;
+} /* free_temp */
+
+static void
+free_child (void *data_p) /**< native data */
+{
+  JERRY_UNUSED (data_p);
+  child_free_count++;
+} /* free_child */
+
+static const jerry_object_native_info_t temp_info =
+{
+  .free_cb = free_temp
+};
+
+static const jerry_object_native_info_t child_info =
+{
+  .free_cb = free_child
+};
+
+static jerry_value_t
+create_native_object (const jerry_object_native_info_t *info_p) /**< native info */
+{
+  jerry_value_t object = jerry_create_object ();
+  jerry_set_object_native_pointer (object, NULL, info_p);
+  return object;
+} /* create_native_object */
+
+class GcGenerationalTest : public testing::Test{
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "GcGenerationalTest SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "GcGenerationalTest TearDownTestCase";
+    }
+
+    void SetUp() override {}
+    void TearDown() override {}
+
+};
+
+static constexpr size_t JERRY_SCRIPT_MEM_SIZE = 50 * 1024 * 1024;
+static void* context_alloc_fn(size_t size, void* cb_data)
+{
+    (void)cb_data;
+    size_t newSize = size > JERRY_SCRIPT_MEM_SIZE ? JERRY_SCRIPT_MEM_SIZE : size;
+    return malloc(newSize);
+}
+HWTEST_F(GcGenerationalTest, Test001, testing::ext::TestSize.Level1)
+{
+  jerry_context_t *ctx_p = jerry_create_context (1024, context_alloc_fn, NULL);
+  jerry_port_default_set_current_context (ctx_p);
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* The holder survives a full collection, so it belongs to the old generation. */
+  jerry_value_t holder = jerry_create_object ();
+  jerry_gc (JERRY_GC_PRESSURE_LOW);
+
+  /* The young child is only reachable from the old holder. */
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) "child");
+  jerry_value_t child = create_native_object (&child_info);
+  jerry_release_value (jerry_set_property (holder, name, child));
+  jerry_release_value (child);
+
+  /* Short lived objects are freed by the collections triggered by the allocator. */
+  for (int i = 0; i < 100000 && temp_free_count < 100; i++)
+  {
+    jerry_release_value (create_native_object (&temp_info));
+  }
+
+  TEST_ASSERT (temp_free_count >= 100);
+  TEST_ASSERT (child_free_count == 0);
+
+  child = jerry_get_property (holder, name);
+  TEST_ASSERT (jerry_get_object_native_pointer (child, NULL, &child_info));
+  jerry_release_value (child);
+
+  TEST_ASSERT (jerry_delete_property (holder, name));
+  jerry_gc (JERRY_GC_PRESSURE_LOW);
+  TEST_ASSERT (child_free_count == 1);
+
+  jerry_release_value (name);
+  jerry_release_value (holder);
+
+  jerry_cleanup ();
+  free (ctx_p);
+}
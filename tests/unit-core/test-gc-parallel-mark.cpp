@@ -0,0 +1,135 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+#include "test-common.h"
+#include <gtest/gtest.h>
+
+#define NATIVE_OBJECT_COUNT 2000
+
+static int free_count = 0;
+
+static void
+free_test_data (void *data_p) /**< native data */
+{
+  JERRY_UNUSED (data_p);
+  free_count++;
+} /* free_test_data */
+
+static const jerry_object_native_info_t test_info =
+{
+  .free_cb = free_test_data
+};
+
+static jerry_value_t
+eval (const char *source_p) /**< source code */
+{
+  return jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+} /* eval */
+
+class GcParallelMarkTest : public testing::Test{
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "GcParallelMarkTest SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "GcParallelMarkTest TearDownTestCase";
+    }
+
+    void SetUp() override {}
+    void TearDown() override {}
+
+};
+
+static constexpr size_t JERRY_SCRIPT_MEM_SIZE = 50 * 1024 * 1024;
+static void* context_alloc_fn(size_t size, void* cb_data)
+{
+    (void)cb_data;
+    size_t newSize = size > JERRY_SCRIPT_MEM_SIZE ? JERRY_SCRIPT_MEM_SIZE : size;
+    return malloc(newSize);
+}
+HWTEST_F(GcParallelMarkTest, Test001, testing::ext::TestSize.Level1)
+{
+  jerry_context_t *ctx_p = jerry_create_context (512 * 1024, context_alloc_fn, NULL);
+  jerry_port_default_set_current_context (ctx_p);
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* Enough objects to run the mark phase in parallel: long chains and wide arrays. */
+  jerry_release_value (eval ("var chains = [];\n"
+                             "for (var i = 0; i < 16; i++) {\n"
+                             "  var head = null;\n"
+                             "  for (var j = 0; j < 200; j++) head = { next: head, value: j };\n"
+                             "  chains.push (head);\n"
+                             "}\n"
+                             "var wide = [];\n"
+                             "for (var i = 0; i < 2000; i++) wide.push ({ value: { index: i } });\n"));
+
+  jerry_value_t holder = jerry_create_object ();
+  jerry_value_t global = jerry_get_global_object ();
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) "holder");
+  jerry_release_value (jerry_set_property (global, name, holder));
+  jerry_release_value (name);
+  jerry_release_value (global);
+
+  /* Every second native object is reachable from the global object. */
+  for (uint32_t i = 0; i < NATIVE_OBJECT_COUNT; i++)
+  {
+    jerry_value_t object = jerry_create_object ();
+    jerry_set_object_native_pointer (object, &free_count, &test_info);
+
+    if (i % 2 == 0)
+    {
+      jerry_release_value (jerry_set_property_by_index (holder, i, object));
+    }
+
+    jerry_release_value (object);
+  }
+
+  jerry_release_value (holder);
+
+  jerry_gc (JERRY_GC_PRESSURE_LOW);
+  TEST_ASSERT (free_count == NATIVE_OBJECT_COUNT / 2);
+
+  /* The reachable objects are intact. */
+  jerry_value_t result = eval ("var sum = 0;\n"
+                               "for (var i = 0; i < chains.length; i++)\n"
+                               "  for (var node = chains[i]; node; node = node.next) sum += node.value;\n"
+                               "for (var i = 0; i < wide.length; i++) sum += wide[i].value.index;\n"
+                               "var count = 0;\n"
+                               "for (var key in holder) count++;\n"
+                               "sum + ':' + count");
+  TEST_ASSERT (jerry_value_is_string (result));
+
+  char buffer[32];
+  jerry_size_t size = jerry_string_to_char_buffer (result, (jerry_char_t *) buffer, sizeof (buffer) - 1);
+  buffer[size] = '\0';
+  /* 16 * (0 + ... + 199) + (0 + ... + 1999) */
+  TEST_ASSERT (strcmp (buffer, "2317400:1000") == 0);
+  jerry_release_value (result);
+
+  jerry_release_value (eval ("chains = null; wide = null; holder = null;"));
+  jerry_gc (JERRY_GC_PRESSURE_LOW);
+  TEST_ASSERT (free_count == NATIVE_OBJECT_COUNT);
+
+  jerry_cleanup ();
+  free (ctx_p);
+}
@@ -0,0 +1,152 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+#include "test-common.h"
+#include <gtest/gtest.h>
+
+static int free_count = 0;
+
+static void
+free_test_data (void *data_p) /**< native data */
+{
+  JERRY_UNUSED (data_p);
+  free_count++;
+} /* free_test_data */
+
+static const jerry_object_native_info_t test_info =
+{
+  .free_cb = free_test_data
+};
+
+static jerry_value_t
+create_native_object (void)
+{
+  jerry_value_t object = jerry_create_object ();
+  jerry_set_object_native_pointer (object, &free_count, &test_info);
+  return object;
+} /* create_native_object */
+
+static void
+finish_gc_cycle (void)
+{
+  /* A zero budget still makes progress, so the cycle must end eventually. */
+  while (jerry_gc_step (0))
+  {
+  }
+} /* finish_gc_cycle */
+
+class GcStepTest : public testing::Test{
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "GcStepTest SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "GcStepTest TearDownTestCase";
+    }
+
+    void SetUp() override {}
+    void TearDown() override {}
+
+};
+
+static constexpr size_t JERRY_SCRIPT_MEM_SIZE = 50 * 1024 * 1024;
+static void* context_alloc_fn(size_t size, void* cb_data)
+{
+    (void)cb_data;
+    size_t newSize = size > JERRY_SCRIPT_MEM_SIZE ? JERRY_SCRIPT_MEM_SIZE : size;
+    return malloc(newSize);
+}
+HWTEST_F(GcStepTest, Test001, testing::ext::TestSize.Level1)
+{
+  jerry_context_t *ctx_p = jerry_create_context (1024, context_alloc_fn, NULL);
+  jerry_port_default_set_current_context (ctx_p);
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_MEM_STATS);
+
+  /* Unreferenced objects are freed by the collection cycle. */
+  jerry_release_value (create_native_object ());
+  finish_gc_cycle ();
+  TEST_ASSERT (free_count == 1);
+
+  /* Objects reachable from a root survive the cycle. */
+  jerry_value_t holder = jerry_create_object ();
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) "child");
+  jerry_value_t child = create_native_object ();
+  jerry_release_value (jerry_set_property (holder, name, child));
+  jerry_release_value (child);
+
+  finish_gc_cycle ();
+  TEST_ASSERT (free_count == 1);
+
+  /* Replace the child while a collection cycle may be in progress. The new child must survive,
+   * the old one is freed by the next cycle at the latest. */
+  jerry_gc_step (0);
+  child = create_native_object ();
+  jerry_release_value (jerry_set_property (holder, name, child));
+  jerry_release_value (child);
+  finish_gc_cycle ();
+  finish_gc_cycle ();
+  TEST_ASSERT (free_count == 2);
+
+  TEST_ASSERT (jerry_delete_property (holder, name));
+  finish_gc_cycle ();
+  TEST_ASSERT (free_count == 3);
+
+  /* A full collection finishes the pending cycle. */
+  jerry_value_t object = create_native_object ();
+  jerry_gc_step (0);
+  jerry_release_value (object);
+  jerry_gc (JERRY_GC_PRESSURE_LOW);
+  TEST_ASSERT (free_count == 4);
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_GC_INCREMENTAL))
+  {
+    TEST_ASSERT (!jerry_gc_step (0));
+  }
+
+  jerry_gc_telemetry_t telemetry;
+  TEST_ASSERT (jerry_get_gc_telemetry (&telemetry));
+
+  size_t pause_count = 0;
+
+  for (size_t i = 0; i < JERRY_GC_PAUSE_HISTOGRAM_SIZE; i++)
+  {
+    pause_count += telemetry.gc_pause_histogram[i];
+  }
+
+  TEST_ASSERT (pause_count > 0);
+  TEST_ASSERT (pause_count == telemetry.gc_pause_count);
+
+  jerry_heap_stats_t stats;
+  memset (&stats, 0, sizeof (stats));
+
+  if (jerry_get_memory_stats (&stats))
+  {
+    TEST_ASSERT (stats.version == 2);
+  }
+
+  jerry_release_value (name);
+  jerry_release_value (holder);
+
+  jerry_cleanup ();
+  free (ctx_p);
+}
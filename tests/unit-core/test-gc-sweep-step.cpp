@@ -0,0 +1,129 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+#include "test-common.h"
+#include <gtest/gtest.h>
+
+#define NATIVE_OBJECT_COUNT 200
+
+static int free_count = 0;
+
+static void
+free_test_data (void *data_p) /**< native data */
+{
+  JERRY_UNUSED (data_p);
+  free_count++;
+} /* free_test_data */
+
+static const jerry_object_native_info_t test_info =
+{
+  .free_cb = free_test_data
+};
+
+class GcSweepStepTest : public testing::Test{
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "GcSweepStepTest SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "GcSweepStepTest TearDownTestCase";
+    }
+
+    void SetUp() override {}
+    void TearDown() override {}
+
+};
+
+static constexpr size_t JERRY_SCRIPT_MEM_SIZE = 50 * 1024 * 1024;
+static void* context_alloc_fn(size_t size, void* cb_data)
+{
+    (void)cb_data;
+    size_t newSize = size > JERRY_SCRIPT_MEM_SIZE ? JERRY_SCRIPT_MEM_SIZE : size;
+    return malloc(newSize);
+}
+HWTEST_F(GcSweepStepTest, Test001, testing::ext::TestSize.Level1)
+{
+  jerry_context_t *ctx_p = jerry_create_context (64 * 1024, context_alloc_fn, NULL);
+  jerry_port_default_set_current_context (ctx_p);
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* The generational collector finds the unreachable old objects when the heap is exhausted,
+   * and all pending objects are freed at that point. */
+  bool is_lazy = (jerry_is_feature_enabled (JERRY_FEATURE_GC_LAZY_SWEEP)
+                  && !jerry_is_feature_enabled (JERRY_FEATURE_GC_GENERATIONAL));
+
+  /* Nothing to sweep yet. */
+  TEST_ASSERT (!jerry_gc_sweep_step (0));
+
+  jerry_value_t objects[NATIVE_OBJECT_COUNT];
+
+  for (int i = 0; i < NATIVE_OBJECT_COUNT; i++)
+  {
+    objects[i] = jerry_create_object ();
+    jerry_set_object_native_pointer (objects[i], &free_count, &test_info);
+  }
+
+  for (int i = 0; i < NATIVE_OBJECT_COUNT; i++)
+  {
+    jerry_release_value (objects[i]);
+  }
+
+  /* Allocate until a collection triggered by the allocator frees the first native object. */
+  while (free_count == 0)
+  {
+    jerry_release_value (jerry_create_object ());
+  }
+
+  if (is_lazy)
+  {
+    /* The allocations free the unreachable objects in small batches. */
+    TEST_ASSERT (free_count < NATIVE_OBJECT_COUNT);
+    TEST_ASSERT (jerry_gc_sweep_step (0));
+
+    /* A zero budget still makes progress, so the sweep must end eventually. */
+    while (jerry_gc_sweep_step (0))
+    {
+    }
+
+    TEST_ASSERT (free_count == NATIVE_OBJECT_COUNT);
+  }
+
+  /* The young objects may be collected earlier than the old ones. */
+  while (free_count < NATIVE_OBJECT_COUNT)
+  {
+    jerry_release_value (jerry_create_object ());
+  }
+
+  TEST_ASSERT (!jerry_gc_sweep_step (0));
+
+  /* A collection requested by the application frees everything immediately. */
+  jerry_value_t object = jerry_create_object ();
+  jerry_set_object_native_pointer (object, &free_count, &test_info);
+  jerry_release_value (object);
+  jerry_gc (JERRY_GC_PRESSURE_LOW);
+  TEST_ASSERT (free_count == NATIVE_OBJECT_COUNT + 1);
+  TEST_ASSERT (!jerry_gc_sweep_step (0));
+
+  jerry_cleanup ();
+  free (ctx_p);
+}
@@ -0,0 +1,111 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+#include "test-common.h"
+#include <gtest/gtest.h>
+
+#define OBJECT_COUNT 100
+
+static size_t
+sum_alloc_count (const jerry_gc_telemetry_t *telemetry_p) /**< telemetry counters */
+{
+  size_t sum = 0;
+
+  for (size_t i = 0; i < JERRY_GC_TELEMETRY_SIZE_CLASS_COUNT; i++)
+  {
+    sum += telemetry_p->alloc_count[i];
+  }
+
+  return sum;
+} /* sum_alloc_count */
+
+class GcTelemetryTest : public testing::Test{
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "GcTelemetryTest SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "GcTelemetryTest TearDownTestCase";
+    }
+
+    void SetUp() override {}
+    void TearDown() override {}
+
+};
+
+static constexpr size_t JERRY_SCRIPT_MEM_SIZE = 50 * 1024 * 1024;
+static void* context_alloc_fn(size_t size, void* cb_data)
+{
+    (void)cb_data;
+    size_t newSize = size > JERRY_SCRIPT_MEM_SIZE ? JERRY_SCRIPT_MEM_SIZE : size;
+    return malloc(newSize);
+}
+HWTEST_F(GcTelemetryTest, Test001, testing::ext::TestSize.Level1)
+{
+  jerry_context_t *ctx_p = jerry_create_context (64 * 1024, context_alloc_fn, NULL);
+  jerry_port_default_set_current_context (ctx_p);
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  TEST_ASSERT (!jerry_get_gc_telemetry (NULL));
+
+  jerry_gc_telemetry_t before;
+  TEST_ASSERT (jerry_get_gc_telemetry (&before));
+  TEST_ASSERT (before.version == 1);
+
+  jerry_value_t objects[OBJECT_COUNT];
+
+  for (int i = 0; i < OBJECT_COUNT; i++)
+  {
+    objects[i] = jerry_create_object ();
+  }
+
+  /* Keep every second object alive. */
+  for (int i = 0; i < OBJECT_COUNT; i += 2)
+  {
+    jerry_release_value (objects[i]);
+  }
+
+  jerry_gc (JERRY_GC_PRESSURE_LOW);
+
+  jerry_gc_telemetry_t after;
+  TEST_ASSERT (jerry_get_gc_telemetry (&after));
+
+  TEST_ASSERT (after.gc_count > before.gc_count);
+  TEST_ASSERT (after.gc_pause_count >= after.gc_count);
+  TEST_ASSERT (after.gc_pause_total_us >= after.gc_pause_max_us);
+  TEST_ASSERT (after.gc_marked_objects >= OBJECT_COUNT / 2);
+  TEST_ASSERT (after.gc_swept_objects >= OBJECT_COUNT / 2);
+  TEST_ASSERT (after.gc_marked_objects_total >= before.gc_marked_objects_total + after.gc_marked_objects);
+  TEST_ASSERT (after.gc_swept_objects_total >= before.gc_swept_objects_total + after.gc_swept_objects);
+  TEST_ASSERT (sum_alloc_count (&after) >= sum_alloc_count (&before) + OBJECT_COUNT);
+  TEST_ASSERT (after.first_fit_steps >= after.first_fit_count);
+  TEST_ASSERT (after.first_fit_count == 0 || after.first_fit_max_steps > 0);
+
+  for (int i = 1; i < OBJECT_COUNT; i += 2)
+  {
+    jerry_release_value (objects[i]);
+  }
+
+  jerry_cleanup ();
+  free (ctx_p);
+}
@@ -0,0 +1,153 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+#include "test-common.h"
+#include <gtest/gtest.h>
+
+static void
+run_setup_script (const char *source_p) /**< script source */
+{
+  jerry_value_t parsed_code = jerry_parse (NULL, 0, (const jerry_char_t *) source_p, strlen (source_p),
+                                           JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (parsed_code));
+
+  jerry_value_t result = jerry_run (parsed_code);
+  TEST_ASSERT (!jerry_value_is_error (result));
+
+  jerry_release_value (result);
+  jerry_release_value (parsed_code);
+} /* run_setup_script */
+
+static bool
+run_test_script (const char *source_p) /**< script source */
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  bool is_true = jerry_value_is_boolean (result) && jerry_get_boolean_value (result);
+  jerry_release_value (result);
+  return is_true;
+} /* run_test_script */
+
+static jerry_value_t
+get_global_property (const char *name_p) /**< property name */
+{
+  jerry_value_t global = jerry_get_global_object ();
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) name_p);
+  jerry_value_t value = jerry_get_property (global, name);
+  jerry_release_value (name);
+  jerry_release_value (global);
+  return value;
+} /* get_global_property */
+
+class InlineCacheTest : public testing::Test{
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "InlineCacheTest SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "InlineCacheTest TearDownTestCase";
+    }
+
+    void SetUp() override {}
+    void TearDown() override {}
+
+};
+
+static constexpr size_t JERRY_SCRIPT_MEM_SIZE = 50 * 1024 * 1024;
+static void* context_alloc_fn(size_t size, void* cb_data)
+{
+    (void)cb_data;
+    size_t newSize = size > JERRY_SCRIPT_MEM_SIZE ? JERRY_SCRIPT_MEM_SIZE : size;
+    return malloc(newSize);
+}
+HWTEST_F(InlineCacheTest, Test001, testing::ext::TestSize.Level1)
+{
+  jerry_context_t *ctx_p = jerry_create_context (512 * 1024, context_alloc_fn, NULL);
+  jerry_port_default_set_current_context (ctx_p);
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_inline_cache_stats_t stats;
+  bool has_stats = jerry_get_inline_cache_stats (&stats);
+
+  TEST_ASSERT (!jerry_get_inline_cache_stats (NULL));
+
+  /* Own and prototype properties of objects with the same shape. */
+  run_setup_script ("function P (x) { this.x = x; this.y = x + 1; }\n"
+                    "P.prototype.m = 10;\n"
+                    "list = []; sum = 0;\n"
+                    "for (var i = 0; i < 20; i++) list.push (new P (i));\n"
+                    "for (var i = 0; i < 20; i++) { var o = list[i]; o.y = o.y + 1; sum += o.x + o.y + o.m; }");
+  TEST_ASSERT (run_test_script ("sum === 2 * 190 + 40 + 200"));
+
+  if (has_stats)
+  {
+    jerry_inline_cache_stats_t new_stats;
+    TEST_ASSERT (jerry_get_inline_cache_stats (&new_stats));
+    TEST_ASSERT (new_stats.version == 1);
+    TEST_ASSERT (new_stats.hits > stats.hits);
+    TEST_ASSERT (new_stats.misses > stats.misses);
+    stats = new_stats;
+  }
+
+  /* The cached entries survive a garbage collection. */
+  jerry_gc (JERRY_GC_PRESSURE_HIGH);
+  run_setup_script ("sum = 0; for (var i = 0; i < 20; i++) sum += list[i].m;");
+  TEST_ASSERT (run_test_script ("sum === 200"));
+
+  if (has_stats)
+  {
+    jerry_inline_cache_stats_t new_stats;
+    TEST_ASSERT (jerry_get_inline_cache_stats (&new_stats));
+    TEST_ASSERT (new_stats.hits > stats.hits);
+  }
+
+  /* Changing the prototype of an object. */
+  jerry_value_t list = get_global_property ("list");
+  jerry_value_t object = jerry_get_property_by_index (list, 5);
+  jerry_value_t proto = jerry_create_object ();
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) "m");
+  jerry_value_t value = jerry_create_number (1);
+  jerry_release_value (jerry_set_property (proto, name, value));
+  jerry_value_t result = jerry_set_prototype (object, proto);
+  TEST_ASSERT (jerry_value_is_boolean (result) && jerry_get_boolean_value (result));
+  jerry_release_value (result);
+  jerry_release_value (value);
+  jerry_release_value (name);
+  jerry_release_value (proto);
+  jerry_release_value (object);
+  jerry_release_value (list);
+
+  run_setup_script ("sum = 0; for (var i = 0; i < 20; i++) sum += list[i].m;");
+  TEST_ASSERT (run_test_script ("sum === 191"));
+
+  /* Shadowed, read-only and accessor properties. */
+  run_setup_script ("list[7].m = 100;\n"
+                    "Object.defineProperty (list[8], 'x', { writable: false });\n"
+                    "Object.defineProperty (list[9], 'y', { get: function () { return -1; } });\n"
+                    "sum = 0;\n"
+                    "for (var i = 0; i < 20; i++) { list[i].x = 0; sum += list[i].m + list[i].y; }");
+  TEST_ASSERT (run_test_script ("sum === 191 + 90 + 230 - 11 - 1"));
+  TEST_ASSERT (run_test_script ("list[8].x === 8 && list[10].x === 0"));
+
+  jerry_cleanup ();
+  free (ctx_p);
+}
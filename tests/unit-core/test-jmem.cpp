@@ -139,3 +139,105 @@ HWTEST_F(JmemTest, Test001, testing::ext::TestSize.Level1)
   free (ctx_p);
   return;
 }
+
+HWTEST_F(JmemTest, Test002, testing::ext::TestSize.Level1)
+{
+  TEST_INIT ();
+  jerry_context_t *ctx_p = jerry_create_context (1024, context_alloc_fn, NULL);
+  jerry_port_default_set_current_context (ctx_p);
+  jmem_init ();
+  ecma_init ();
+
+  {
+    uint8_t *block1_p = (uint8_t *) jmem_heap_alloc_block (24);
+    uint8_t *block2_p = (uint8_t *) jmem_heap_alloc_block (24);
+
+    jmem_heap_free_block (block1_p, 24);
+
+    /* The freed block is reused by the next allocation of the same aligned size. */
+    uint8_t *block3_p = (uint8_t *) jmem_heap_alloc_block (20);
+    TEST_ASSERT (block3_p == block1_p);
+
+    jmem_heap_free_block (block2_p, 24);
+    jmem_heap_free_block (block3_p, 20);
+  }
+
+  {
+    uint8_t *blocks_p[128];
+    size_t count = 0;
+
+    /* Fill the heap with small blocks. */
+    while (count < sizeof (blocks_p) / sizeof (blocks_p[0]))
+    {
+      blocks_p[count] = (uint8_t *) jmem_heap_alloc_block_null_on_error (BASIC_SIZE / 2);
+
+      if (blocks_p[count] == NULL)
+      {
+        break;
+      }
+
+      count++;
+    }
+
+    TEST_ASSERT (count >= 4);
+
+    for (size_t i = 0; i < count; i++)
+    {
+      jmem_heap_free_block (blocks_p[i], BASIC_SIZE / 2);
+    }
+
+    /* The freed small blocks must be merged to satisfy a large request. */
+    size_t large_size = (count / 2) * (BASIC_SIZE / 2);
+    uint8_t *large_p = (uint8_t *) jmem_heap_alloc_block_null_on_error (large_size);
+    TEST_ASSERT (large_p != NULL);
+
+    jmem_heap_free_block (large_p, large_size);
+  }
+
+  ecma_finalize ();
+  jmem_finalize ();
+  free (ctx_p);
+  return;
+}
+
+HWTEST_F(JmemTest, Test003, testing::ext::TestSize.Level1)
+{
+  TEST_INIT ();
+  jerry_context_t *ctx_p = jerry_create_context (8 * 1024, context_alloc_fn, NULL);
+  jerry_port_default_set_current_context (ctx_p);
+  jmem_init ();
+  ecma_init ();
+
+  {
+    uint8_t *blocks_p[64];
+
+    /* Small blocks of two sizes, interleaved. */
+    for (size_t i = 0; i < 64; i++)
+    {
+      blocks_p[i] = (uint8_t *) jmem_heap_alloc_block ((i % 2 == 0) ? 16 : 20);
+      memset (blocks_p[i], (int) i, (i % 2 == 0) ? 16 : 20);
+    }
+
+#if ENABLED (JERRY_MEM_SLAB_ALLOCATOR)
+    /* Blocks of the same size are allocated from the consecutive slots of a slab. */
+    TEST_ASSERT (blocks_p[2] == blocks_p[0] + 16);
+    TEST_ASSERT (blocks_p[3] == blocks_p[1] + 24);
+#endif /* ENABLED (JERRY_MEM_SLAB_ALLOCATOR) */
+
+    for (size_t i = 0; i < 64; i++)
+    {
+      TEST_ASSERT (blocks_p[i][0] == (uint8_t) i);
+      jmem_heap_free_block (blocks_p[i], (i % 2 == 0) ? 16 : 20);
+    }
+
+    /* The memory of the small blocks is returned to the heap. */
+    uint8_t *large_p = (uint8_t *) jmem_heap_alloc_block_null_on_error (4 * 1024);
+    TEST_ASSERT (large_p != NULL);
+    jmem_heap_free_block (large_p, 4 * 1024);
+  }
+
+  ecma_finalize ();
+  jmem_finalize ();
+  free (ctx_p);
+  return;
+}
@@ -0,0 +1,171 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+#include "test-common.h"
+#include <gtest/gtest.h>
+
+static int free_count = 0;
+
+static void
+free_test_data (void *data_p) /**< native data */
+{
+  JERRY_UNUSED (data_p);
+  free_count++;
+} /* free_test_data */
+
+static const jerry_object_native_info_t test_info =
+{
+  .free_cb = free_test_data
+};
+
+static void
+run_setup_script (const char *source_p) /**< script source */
+{
+  jerry_value_t parsed_code = jerry_parse (NULL, 0, (const jerry_char_t *) source_p, strlen (source_p),
+                                           JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (parsed_code));
+
+  jerry_value_t result = jerry_run (parsed_code);
+  TEST_ASSERT (!jerry_value_is_error (result));
+
+  jerry_release_value (result);
+  jerry_release_value (parsed_code);
+} /* run_setup_script */
+
+static bool
+run_test_script (const char *source_p) /**< script source */
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  bool is_true = jerry_value_is_boolean (result) && jerry_get_boolean_value (result);
+  jerry_release_value (result);
+  return is_true;
+} /* run_test_script */
+
+static double
+get_number_property (jerry_value_t object, /**< object */
+                     const char *name_p) /**< property name */
+{
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) name_p);
+  jerry_value_t value = jerry_get_property (object, name);
+  TEST_ASSERT (jerry_value_is_number (value));
+  double number = jerry_get_number_value (value);
+  jerry_release_value (value);
+  jerry_release_value (name);
+  return number;
+} /* get_number_property */
+
+static void
+set_number_property (jerry_value_t object, /**< object */
+                     const char *name_p, /**< property name */
+                     double number) /**< property value */
+{
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) name_p);
+  jerry_value_t value = jerry_create_number (number);
+  jerry_release_value (jerry_set_property (object, name, value));
+  jerry_release_value (value);
+  jerry_release_value (name);
+} /* set_number_property */
+
+class ObjectShapesTest : public testing::Test{
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "ObjectShapesTest SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "ObjectShapesTest TearDownTestCase";
+    }
+
+    void SetUp() override {}
+    void TearDown() override {}
+
+};
+
+static constexpr size_t JERRY_SCRIPT_MEM_SIZE = 50 * 1024 * 1024;
+static void* context_alloc_fn(size_t size, void* cb_data)
+{
+    (void)cb_data;
+    size_t newSize = size > JERRY_SCRIPT_MEM_SIZE ? JERRY_SCRIPT_MEM_SIZE : size;
+    return malloc(newSize);
+}
+HWTEST_F(ObjectShapesTest, Test001, testing::ext::TestSize.Level1)
+{
+  jerry_context_t *ctx_p = jerry_create_context (512 * 1024, context_alloc_fn, NULL);
+  jerry_port_default_set_current_context (ctx_p);
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* Objects created by the same code share the property layout but not the values. */
+  jerry_value_t first = jerry_create_object ();
+  jerry_value_t second = jerry_create_object ();
+  set_number_property (first, "x", 1);
+  set_number_property (first, "y", 2);
+  set_number_property (second, "x", 3);
+  set_number_property (second, "y", 4);
+  set_number_property (first, "x", 5);
+
+  jerry_gc (JERRY_GC_PRESSURE_LOW);
+  TEST_ASSERT (get_number_property (first, "x") == 5);
+  TEST_ASSERT (get_number_property (first, "y") == 2);
+  TEST_ASSERT (get_number_property (second, "x") == 3);
+  TEST_ASSERT (get_number_property (second, "y") == 4);
+
+  /* Deleting a property keeps the remaining ones. */
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) "x");
+  TEST_ASSERT (jerry_delete_property (first, name));
+  jerry_release_value (name);
+  TEST_ASSERT (get_number_property (first, "y") == 2);
+  TEST_ASSERT (get_number_property (second, "x") == 3);
+
+  jerry_value_t keys = jerry_get_object_keys (first);
+  TEST_ASSERT (jerry_get_array_length (keys) == 1);
+  jerry_release_value (keys);
+
+  /* Native pointers are stored as internal properties. */
+  jerry_set_object_native_pointer (second, &free_count, &test_info);
+  TEST_ASSERT (get_number_property (second, "y") == 4);
+
+  jerry_release_value (first);
+  jerry_release_value (second);
+  jerry_gc (JERRY_GC_PRESSURE_LOW);
+  TEST_ASSERT (free_count == 1);
+
+  run_setup_script ("function P (x, y) { this.x = x; this.y = y; }\n"
+                    "a = new P (1, 2); b = new P (3, 4);\n"
+                    "b.x = 5; a.z = 6;");
+  TEST_ASSERT (run_test_script ("a.x === 1 && a.y === 2 && a.z === 6 && b.x === 5 && b.y === 4"));
+  TEST_ASSERT (run_test_script ("!('z' in b) && Object.keys (a).join () === 'x,y,z'"));
+
+  /* Objects with many properties and accessors. */
+  run_setup_script ("o = {}; s = 0;\n"
+                    "for (i = 0; i < 40; i++) o['p' + i] = i;\n"
+                    "for (k in o) s += o[k];\n"
+                    "g = { a: 1, get b () { return this.a + 1; } };");
+  TEST_ASSERT (run_test_script ("s === 780 && g.b === 2 && JSON.stringify (g) === '{\"a\":1,\"b\":2}'"));
+
+  /* Many distinct layouts. */
+  run_setup_script ("list = [];\n"
+                    "for (i = 0; i < 1000; i++) { o = {}; o['q' + i] = i; o.r = i; list.push (o); }");
+  TEST_ASSERT (run_test_script ("list[999].q999 === 999 && list[500].r === 500"));
+
+  jerry_cleanup ();
+  free (ctx_p);
+}
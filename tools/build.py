@@ -128,8 +128,54 @@ def get_arguments():
                          help='memory usage limit to trigger garbage collection (in bytes)')
     coregrp.add_argument('--stack-limit', metavar='SIZE', type=int,
                          help='maximum stack usage (in kilobytes)')
+    coregrp.add_argument('--vm-stack-size', metavar='SIZE', type=int,
+                         help='size of the VM stack of the function frames (in kilobytes)')
+    coregrp.add_argument('--gc-incremental', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable incremental garbage collection (%(choices)s)')
+    coregrp.add_argument('--gc-generational', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable generational garbage collection (%(choices)s)')
+    coregrp.add_argument('--mem-size-classes', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable size class free lists for small heap blocks (%(choices)s)')
+    coregrp.add_argument('--mem-slab-allocator', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable the slab allocator for small heap blocks (%(choices)s)')
+    coregrp.add_argument('--gc-compaction', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable compaction of property and array storage by jerry_gc (%(choices)s)')
+    coregrp.add_argument('--gc-lazy-sweep', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable lazy sweeping of unreachable objects (%(choices)s)')
+    coregrp.add_argument('--gc-adaptive-limit', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable the adaptive garbage collection trigger (%(choices)s)')
+    coregrp.add_argument('--gc-parallel-mark', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable parallel marking of the garbage collector (%(choices)s)')
+    coregrp.add_argument('--vm-computed-goto', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable direct threaded dispatch in the VM (%(choices)s)')
+    coregrp.add_argument('--object-shapes', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable shared shapes for ordinary objects (%(choices)s)')
+    coregrp.add_argument('--inline-cache', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable inline caches of property accesses (%(choices)s)')
+    coregrp.add_argument('--vm-superinstructions', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable fused compare and branch byte codes (%(choices)s)')
+    coregrp.add_argument('--vm-three-address-opcodes', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable three-address forms of binary byte codes (%(choices)s)')
+    coregrp.add_argument('--vm-direct-calls', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable calls between byte code functions without recursion (requires --vm-stack-size) (%(choices)s)')
+    coregrp.add_argument('--vm-profiler', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable the sampling profiler (%(choices)s)')
+    coregrp.add_argument('--rope-strings', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable rope strings for long concatenations (%(choices)s)')
+    coregrp.add_argument('--string-index', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable index tables for accessing characters of non-ASCII strings (%(choices)s)')
+    coregrp.add_argument('--lit-hash-table', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable hash tables for the literal strings and numbers (%(choices)s)')
+    coregrp.add_argument('--direct-float', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable directly encoded floating point numbers (%(choices)s)')
     coregrp.add_argument('--gc-mark-limit', metavar='SIZE', type=int,
-                         help='maximum depth of recursion during GC mark phase')
+                         help='size of the gray object worklist of the GC mark phase')
+    coregrp.add_argument('--gc-target-pause', metavar='TIME', type=int,
+                         help='target pause of the adaptive garbage collection trigger (in microseconds)')
+    coregrp.add_argument('--gc-heap-growth', metavar='PERCENT', type=int,
+                         help='heap growth of the adaptive garbage collection trigger (in percent of the live heap)')
+    coregrp.add_argument('--gc-mark-threads', metavar='COUNT', type=int,
+                         help='number of workers of the parallel garbage collector marking')
     coregrp.add_argument('--mem-stats', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable memory statistics (%(choices)s)'))
     coregrp.add_argument('--mem-stress-test', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -205,6 +251,26 @@ def generate_build_options(arguments):
     build_options_append('JERRY_GLOBAL_HEAP_SIZE', arguments.mem_heap)
     build_options_append('JERRY_GC_LIMIT', arguments.gc_limit)
     build_options_append('JERRY_STACK_LIMIT', arguments.stack_limit)
+    build_options_append('JERRY_DIRECT_FLOAT', arguments.direct_float)
+    build_options_append('JERRY_LIT_HASH_TABLE', arguments.lit_hash_table)
+    build_options_append('JERRY_STRING_INDEX', arguments.string_index)
+    build_options_append('JERRY_ROPE_STRINGS', arguments.rope_strings)
+    build_options_append('JERRY_VM_PROFILER', arguments.vm_profiler)
+    build_options_append('JERRY_VM_DIRECT_CALLS', arguments.vm_direct_calls)
+    build_options_append('JERRY_VM_STACK_SIZE', arguments.vm_stack_size)
+    build_options_append('JERRY_VM_THREE_ADDRESS_OPCODES', arguments.vm_three_address_opcodes)
+    build_options_append('JERRY_VM_SUPERINSTRUCTIONS', arguments.vm_superinstructions)
+    build_options_append('JERRY_INLINE_CACHE', arguments.inline_cache)
+    build_options_append('JERRY_OBJECT_SHAPES', arguments.object_shapes)
+    build_options_append('JERRY_VM_COMPUTED_GOTO', arguments.vm_computed_goto)
+    build_options_append('JERRY_GC_PARALLEL_MARK', arguments.gc_parallel_mark)
+    build_options_append('JERRY_GC_ADAPTIVE_LIMIT', arguments.gc_adaptive_limit)
+    build_options_append('JERRY_GC_LAZY_SWEEP', arguments.gc_lazy_sweep)
+    build_options_append('JERRY_GC_COMPACTION', arguments.gc_compaction)
+    build_options_append('JERRY_MEM_SLAB_ALLOCATOR', arguments.mem_slab_allocator)
+    build_options_append('JERRY_MEM_SIZE_CLASSES', arguments.mem_size_classes)
+    build_options_append('JERRY_GC_GENERATIONAL', arguments.gc_generational)
+    build_options_append('JERRY_GC_INCREMENTAL', arguments.gc_incremental)
     build_options_append('JERRY_MEM_STATS', arguments.mem_stats)
     build_options_append('JERRY_MEM_GC_BEFORE_EACH_ALLOC', arguments.mem_stress_test)
     build_options_append('JERRY_PROFILE', arguments.profile)
@@ -220,6 +286,15 @@ def generate_build_options(arguments):
     if arguments.gc_mark_limit is not None:
         build_options.append('-D%s=%s' % ('JERRY_GC_MARK_LIMIT', arguments.gc_mark_limit))
 
+    if arguments.gc_target_pause is not None:
+        build_options.append('-D%s=%s' % ('JERRY_GC_TARGET_PAUSE', arguments.gc_target_pause))
+
+    if arguments.gc_heap_growth is not None:
+        build_options.append('-D%s=%s' % ('JERRY_GC_HEAP_GROWTH', arguments.gc_heap_growth))
+
+    if arguments.gc_mark_threads is not None:
+        build_options.append('-D%s=%s' % ('JERRY_GC_MARK_THREADS', arguments.gc_mark_threads))
+
     # jerry-main options
     build_options_append('ENABLE_LINK_MAP', arguments.link_map)
 
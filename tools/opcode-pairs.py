@@ -0,0 +1,115 @@
+#!/usr/bin/env python
+
+# Copyright JS Foundation and other contributors, http://js.foundation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+from __future__ import print_function
+
+import argparse
+import collections
+import os
+import re
+import subprocess
+import sys
+
+DUMP_START = 'Final byte code dump:'
+DUMP_END = 'Byte code size:'
+INSTRUCTION_RE = re.compile(r'^\s*\d+ : (CBC_[A-Z0-9_]+)')
+
+
+def get_args():
+    """ Parse input arguments. """
+    desc = 'Counts the opcode sequences of the final byte code dumps printed by --show-opcodes'
+    parser = argparse.ArgumentParser(description=desc)
+    parser.add_argument('--engine', metavar='FILE',
+                        help='jerry binary built with JERRY_PARSER_DUMP_BYTE_CODE, the inputs '
+                             'are JavaScript sources which are parsed by this binary')
+    parser.add_argument('--length', metavar='N', type=int, default=2,
+                        help='length of the counted opcode sequences (default: %(default)s)')
+    parser.add_argument('--top', metavar='N', type=int, default=20,
+                        help='number of printed sequences (default: %(default)s)')
+    parser.add_argument('inputs', metavar='PATH', nargs='+',
+                        help='byte code dumps, or JavaScript sources and directories when --engine is specified')
+    return parser.parse_args()
+
+
+def collect_sources(paths):
+    """ Collect the JavaScript files of the given paths. """
+    sources = []
+    for path in paths:
+        if os.path.isdir(path):
+            for root, _, files in os.walk(path):
+                sources.extend(os.path.join(root, name) for name in sorted(files) if name.endswith('.js'))
+        else:
+            sources.append(path)
+    return sources
+
+
+def get_dumps(args):
+    """ Yield the --show-opcodes output of each input. """
+    if not args.engine:
+        for path in args.inputs:
+            with open(path) as dump:
+                yield dump.read()
+        return
+
+    for source in collect_sources(args.inputs):
+        proc = subprocess.Popen([args.engine, '--show-opcodes', '--parse-only', source],
+                                stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+        output, _ = proc.communicate()
+        yield output.decode('utf-8', 'replace')
+
+
+def count_sequences(dump, length, counter):
+    """ Count the opcode sequences of the final byte code listings of a dump. """
+    opcodes = None
+
+    for line in dump.splitlines():
+        if line.strip() == DUMP_START:
+            opcodes = []
+        elif opcodes is not None:
+            if line.startswith(DUMP_END):
+                for i in range(len(opcodes) - length + 1):
+                    counter[tuple(opcodes[i:i + length])] += 1
+                opcodes = None
+                continue
+
+            match = INSTRUCTION_RE.match(line)
+            if match:
+                opcodes.append(match.group(1))
+
+
+def main():
+    args = get_args()
+
+    if args.length < 1:
+        print('Sequence length must be positive')
+        return 1
+
+    counter = collections.Counter()
+    for dump in get_dumps(args):
+        count_sequences(dump, args.length, counter)
+
+    total = sum(counter.values())
+    if total == 0:
+        print('No byte code dump found (is JERRY_PARSER_DUMP_BYTE_CODE enabled?)')
+        return 1
+
+    for sequence, count in counter.most_common(args.top):
+        print('%8d %6.2f%%  %s' % (count, 100.0 * count / total, ' '.join(sequence)))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
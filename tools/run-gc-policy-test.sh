@@ -0,0 +1,96 @@
+#!/bin/bash
+
+# Copyright JS Foundation and other contributors, http://js.foundation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compares the garbage collection behaviour of two engines (e.g. built with and
+# without JERRY_GC_ADAPTIVE_LIMIT). Both engines must be built with memory statistics.
+#
+# Usage: run-gc-policy-test.sh [-d] <engine> <engine> <benchmark.js>...
+
+# Choosing table or semicolon-separated output mode
+if [ "$1" == "-d" ]
+then
+  TABLE="no"
+  PRINT_TEST_NAME_AWK_SCRIPT='{printf "%s;", $1}'
+  PRINT_TOTAL_AWK_SCRIPT='{printf "%d;%d;%d;%d;%d;%d\n", $1, $4, $2, $5, $3, $6}'
+
+  shift
+else
+  PRINT_TEST_NAME_AWK_SCRIPT='{printf "%30s", $1}'
+  PRINT_TOTAL_AWK_SCRIPT='{printf "%10d%10d%14d%14d%12d%12d\n", $1, $4, $2, $5, $3, $6}'
+  TABLE="yes"
+fi
+
+function fail_msg
+{
+  echo "$1"
+  exit 1
+}
+
+# Check if the specified build supports memory statistics options
+function is_mem_stats_build
+{
+  [ -x "$1" ] || fail_msg "Engine '$1' is not executable"
+
+  tmpfile=`mktemp`
+  "$1" --mem-stats $tmpfile 2>&1 | grep -- "Ignoring JERRY_INIT_MEM_STATS flag because of !JMEM_STATS configuration." 2>&1 > /dev/null
+  code=$?
+  rm $tmpfile
+
+  return $code
+}
+
+# Prints the number of collections, the total pause time and the peak heap usage
+function gc_stats
+{
+  "$1" --mem-stats "$2" 2>&1 | awk '
+    /^    [<>]=? [0-9]+ us =/ { runs += $NF }
+    /GC pause total =/ { total = $5 }
+    /Peak allocated =/ { peak = $4 }
+    END { printf "%d %d %d\n", runs, total, peak }'
+}
+
+JERRY_A="$1"
+shift
+is_mem_stats_build "$JERRY_A" && fail_msg "Engine '$JERRY_A' should be built with memory statistics support"
+
+JERRY_B="$1"
+shift
+is_mem_stats_build "$JERRY_B" && fail_msg "Engine '$JERRY_B' should be built with memory statistics support"
+
+# Running
+if [ "$TABLE" == "yes" ]
+then
+  awk 'BEGIN {printf "%30s%20s%28s%24s\n", "Test name", "GC runs (A/B)", "GC pause total (A/B, us)", "Peak heap (A/B)"}'
+  echo
+fi
+
+TOTALS="0 0 0 0 0 0"
+
+while [ $# -ne 0 ]
+do
+  bench="$1"
+  shift
+  test=`basename $bench .js`
+
+  RESULT="$(gc_stats "$JERRY_A" $bench) $(gc_stats "$JERRY_B" $bench)"
+  TOTALS=$(echo $TOTALS $RESULT | awk '{printf "%d %d %d %d %d %d", $1 + $7, $2 + $8, $3 + $9, $4 + $10, $5 + $11, $6 + $12}')
+
+  echo "$test" | awk "$PRINT_TEST_NAME_AWK_SCRIPT"
+  echo $RESULT | awk "$PRINT_TOTAL_AWK_SCRIPT"
+done
+
+echo "total" | awk "$PRINT_TEST_NAME_AWK_SCRIPT"
+echo $TOTALS | awk "$PRINT_TOTAL_AWK_SCRIPT"